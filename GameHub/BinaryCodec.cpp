@@ -0,0 +1,115 @@
+#include "BinaryCodec.h"
+#include <algorithm>
+
+BinaryWriter::BinaryWriter() : used(0) {}
+
+char* BinaryWriter::grow(size_t bytes) 
+{
+    if (buffer.size() - used < bytes) 
+    {
+        buffer.resize((std::max)(buffer.size() * 2, used + bytes));
+    }
+    char* position = &buffer[used];
+    used += bytes;
+    return position;
+}
+
+void BinaryWriter::writeBytes(const char* data, size_t size) 
+{
+    if (size > 0) 
+    {
+        std::memcpy(grow(size), data, size);
+    }
+}
+
+void BinaryWriter::writeString(const std::string& value) 
+{
+    write(value.size());
+    writeBytes(value.data(), value.size());
+}
+
+void BinaryWriter::writeStringList(const std::vector<std::string>& values) 
+{
+    write(values.size());
+    for (const auto& value : values) 
+    {
+        writeString(value);
+    }
+}
+
+const char* BinaryWriter::data() const { return buffer.data(); }
+size_t BinaryWriter::size() const { return used; }
+
+void BinaryWriter::reserve(size_t capacity) 
+{
+    if (buffer.size() < capacity) 
+    {
+        buffer.resize(capacity);
+    }
+}
+
+void BinaryWriter::clear() { used = 0; }
+
+BinaryReader::BinaryReader() : current(nullptr), limit(nullptr) {}
+
+BinaryReader::BinaryReader(const char* begin, const char* end) : current(begin), limit(end) {}
+
+void BinaryReader::reset(const char* begin, const char* end) 
+{
+    current = begin;
+    limit = end;
+}
+
+void BinaryReader::require(size_t bytes) const 
+{
+    if (bytes > static_cast<size_t>(limit - current)) 
+    {
+        throw FileIOException("Record field extends beyond record bounds");
+    }
+}
+
+StringRef BinaryReader::readStringRef() 
+{
+    size_t size = read<size_t>();
+    require(size);
+    StringRef value(current, size);
+    current += size;
+    return value;
+}
+
+void BinaryReader::readString(std::string& value) 
+{
+    StringRef ref = readStringRef();
+    value.assign(ref.data, ref.size);
+}
+
+std::string BinaryReader::readString() 
+{
+    StringRef ref = readStringRef();
+    return std::string(ref.data, ref.size);
+}
+
+void BinaryReader::readStringList(std::vector<std::string>& values) 
+{
+    size_t count = read<size_t>();
+    //       ,        resize
+    if (count > remaining() / sizeof(size_t)) 
+    {
+        throw FileIOException("Record field extends beyond record bounds");
+    }
+    values.resize(count);
+    for (auto& value : values) 
+    {
+        readString(value);
+    }
+}
+
+void BinaryReader::skip(size_t bytes) 
+{
+    require(bytes);
+    current += bytes;
+}
+
+const char* BinaryReader::position() const { return current; }
+const char* BinaryReader::end() const { return limit; }
+size_t BinaryReader::remaining() const { return static_cast<size_t>(limit - current); }
@@ -0,0 +1,94 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstring>
+#include <type_traits>
+#include "Exceptions.h"
+
+//        
+struct StringRef 
+{
+    const char* data;
+    size_t size;
+
+    StringRef() : data(nullptr), size(0) {}
+    StringRef(const char* text, size_t length) : data(text), size(length) {}
+
+    std::string str() const { return std::string(data, size); }
+    bool operator==(const std::string& other) const { return other.size() == size && other.compare(0, size, data, size) == 0; }
+};
+
+//      .     
+//  :   ,  -  size_t  .
+class BinaryWriter 
+{
+private:
+    //       memcpy, used -   
+    std::string buffer;
+    size_t used;
+
+    char* grow(size_t bytes);
+
+public:
+    BinaryWriter();
+
+    template<typename T>
+    void write(const T& value) 
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "BinaryWriter::write requires a trivially copyable type");
+        std::memcpy(grow(sizeof(T)), &value, sizeof(T));
+    }
+
+    void writeBytes(const char* data, size_t size);
+    void writeString(const std::string& value);
+    void writeStringList(const std::vector<std::string>& values);
+
+    const char* data() const;
+    size_t size() const;
+    void reserve(size_t capacity);
+    //  ,       
+    void clear();
+};
+
+//          
+class BinaryReader 
+{
+private:
+    const char* current;
+    const char* limit;
+
+    void require(size_t bytes) const;
+
+public:
+    BinaryReader();
+    BinaryReader(const char* begin, const char* end);
+
+    void reset(const char* begin, const char* end);
+
+    template<typename T>
+    T read() 
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "BinaryReader::read requires a trivially copyable type");
+        require(sizeof(T));
+        T value;
+        std::memcpy(&value, current, sizeof(T));
+        current += sizeof(T);
+        return value;
+    }
+
+    template<typename T>
+    void read(T& value) 
+    {
+        value = read<T>();
+    }
+
+    StringRef readStringRef();
+    void readString(std::string& value);
+    std::string readString();
+    void readStringList(std::vector<std::string>& values);
+
+    void skip(size_t bytes);
+    const char* position() const;
+    const char* end() const;
+    size_t remaining() const;
+};
@@ -0,0 +1,471 @@
+#include "Checkpoint.h"
+#include "BinaryCodec.h"
+#include "DataFile.h"
+#include "CommitQueue.h"
+#include <unordered_set>
+#include <cstdio>
+#include <io.h>
+
+Checkpoint* Checkpoint::instance = nullptr;
+std::mutex Checkpoint::instanceMutex;
+
+void Checkpoint::Overlay::apply(const Change& change) 
+{
+    auto it = positions.find(change.key);
+    if (it != positions.end()) 
+    {
+        changes[it->second] = change;
+        return;
+    }
+    positions[change.key] = changes.size();
+    changes.push_back(change);
+}
+
+const Checkpoint::Change* Checkpoint::Overlay::find(const std::string& key) const 
+{
+    auto it = positions.find(key);
+    return (it != positions.end()) ? &changes[it->second] : nullptr;
+}
+
+size_t Checkpoint::Overlay::indexOf(const Change* change) const 
+{
+    return static_cast<size_t>(change - changes.data());
+}
+
+const std::vector<Checkpoint::Change>& Checkpoint::Overlay::getChanges() const 
+{
+    return changes;
+}
+
+bool Checkpoint::Overlay::empty() const 
+{
+    return changes.empty();
+}
+
+Checkpoint::Checkpoint() : logFile(Config::CHECKPOINT_LOG_FILE), oldLogFile(Config::CHECKPOINT_LOG_FILE + ".old"),
+    pendingChanges(0), enabled(false), stopping(false), compactRequested(false) 
+{
+    logger = Logger::getInstance();
+
+    // ,    ,     
+    replay(oldLogFile, frozen);
+    replay(logFile, active);
+}
+
+Checkpoint* Checkpoint::getInstance() 
+{
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    if (instance == nullptr) 
+    {
+        instance = new Checkpoint();
+    }
+    return instance;
+}
+
+uint64_t Checkpoint::hash(const std::string& bytes) 
+{
+    uint64_t value = 14695981039346656037ull;
+    for (char c : bytes) 
+    {
+        value ^= static_cast<unsigned char>(c);
+        value *= 1099511628211ull;
+    }
+    return value;
+}
+
+void Checkpoint::replay(const std::string& filename, std::map<std::string, Overlay>& target) 
+{
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) 
+    {
+        return;
+    }
+    std::string contents(static_cast<size_t>(file.tellg()), '\0');
+    file.seekg(0);
+    if (!contents.empty() && !file.read(&contents[0], contents.size())) 
+    {
+        throw FileIOException("Cannot read checkpoint log: " + filename);
+    }
+    file.close();
+
+    BinaryReader frames(contents.data(), contents.data() + contents.size());
+    size_t valid = 0;
+    size_t replayed = 0;
+    try 
+    {
+        while (frames.remaining() > 0) 
+        {
+            if (frames.remaining() < sizeof(size_t)) 
+            {
+                break;
+            }
+            size_t length = frames.read<size_t>();
+            if (length > frames.remaining() || frames.remaining() - length < sizeof(uint32_t)) 
+            {
+                break;
+            }
+
+            const char* payload = frames.position();
+            frames.skip(length);
+            if (DataFormat::crc32(payload, length) != frames.read<uint32_t>()) 
+            {
+                break;
+            }
+
+            BinaryReader in(payload, payload + length);
+            Overlay& overlay = target[in.readString()];
+            uint64_t count = in.read<uint64_t>();
+            for (uint64_t i = 0; i < count; ++i) 
+            {
+                Change change;
+                in.readString(change.key);
+                change.removed = in.read<uint8_t>() != 0;
+                in.readString(change.record);
+                overlay.apply(change);
+            }
+            valid = static_cast<size_t>(frames.position() - contents.data());
+            replayed += static_cast<size_t>(count);
+        }
+    }
+    catch (const std::exception&) 
+    {
+    }
+
+    //     ,      
+    if (valid < contents.size()) 
+    {
+        logger->log(LogLevel::WARNING, "Torn record at the end of checkpoint log " + filename + " ignored");
+        std::ofstream rewrite(filename, std::ios::binary | std::ios::trunc);
+        rewrite.write(contents.data(), valid);
+        if (!rewrite) 
+        {
+            throw FileIOException("Cannot truncate checkpoint log: " + filename);
+        }
+    }
+
+    pendingChanges += replayed;
+    if (replayed > 0) 
+    {
+        logger->log(LogLevel::INFO, "Checkpoint log replayed from " + filename + ", changes: " + std::to_string(replayed));
+    }
+}
+
+void Checkpoint::track(const std::string& filename, uint16_t revision, Loader load) 
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    tables[filename] = Table{ revision, load };
+}
+
+bool Checkpoint::isTracked(const std::string& filename) 
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    return tables.count(filename) > 0;
+}
+
+Checkpoint::Loader Checkpoint::findLoader(const std::string& filename, uint16_t& revision) 
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = tables.find(filename);
+    if (it == tables.end()) 
+    {
+        throw FileIOException("File is not tracked by checkpoints: " + filename);
+    }
+    revision = it->second.revision;
+    return it->second.load;
+}
+
+void Checkpoint::enable() 
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (enabled) 
+        {
+            return;
+        }
+        enabled = true;
+        stopping = false;
+        compactRequested = !active.empty() || !frozen.empty();
+        worker = std::thread(&Checkpoint::run, this);
+    }
+    wakeUp.notify_all();
+    logger->log(LogLevel::INFO, "Incremental checkpoints enabled");
+}
+
+void Checkpoint::disable() 
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (!enabled) 
+        {
+            return;
+        }
+        enabled = false;
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    worker.join();
+
+    //      ,       
+    compactAll();
+    std::lock_guard<std::mutex> lock(mtx);
+    baselines.clear();
+}
+
+bool Checkpoint::isEnabled() 
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    return enabled;
+}
+
+std::shared_ptr<Checkpoint::Overlay> Checkpoint::getOverlay(const std::string& filename) 
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    auto older = frozen.find(filename);
+    auto newer = active.find(filename);
+    if (older == frozen.end() && newer == active.end()) 
+    {
+        return nullptr;
+    }
+
+    auto overlay = std::make_shared<Overlay>();
+    if (older != frozen.end()) 
+    {
+        *overlay = older->second;
+    }
+    if (newer != active.end()) 
+    {
+        for (const auto& change : newer->second.getChanges()) 
+        {
+            overlay->apply(change);
+        }
+    }
+    return overlay;
+}
+
+void Checkpoint::appendFrame(const std::string& filename, const std::vector<Change>& changes) 
+{
+    BinaryWriter payload;
+    payload.writeString(filename);
+    payload.write<uint64_t>(changes.size());
+    for (const auto& change : changes) 
+    {
+        payload.writeString(change.key);
+        payload.write<uint8_t>(change.removed ? 1 : 0);
+        payload.writeString(change.record);
+    }
+
+    size_t length = payload.size();
+    uint32_t sum = DataFormat::crc32(payload.data(), payload.size());
+
+    std::string frame;
+    frame.reserve(sizeof(length) + length + sizeof(sum));
+    frame.append(reinterpret_cast<const char*>(&length), sizeof(length));
+    frame.append(payload.data(), payload.size());
+    frame.append(reinterpret_cast<const char*>(&sum), sizeof(sum));
+
+    //      ,      ,  replaceFile
+    FILE* file = nullptr;
+    if (fopen_s(&file, logFile.c_str(), "ab") != 0 || !file) 
+    {
+        throw FileIOException("Cannot open checkpoint log for writing: " + logFile);
+    }
+    bool written = fwrite(frame.data(), 1, frame.size(), file) == frame.size() &&
+        fflush(file) == 0 && _commit(_fileno(file)) == 0;
+    written = (fclose(file) == 0) && written;
+    if (!written) 
+    {
+        throw FileIOException("Cannot append to checkpoint log: " + logFile);
+    }
+}
+
+size_t Checkpoint::commit(const std::string& filename, const std::vector<Record>& records) 
+{
+    //      :      
+    bool known; 
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        known = baselines.count(filename) > 0;
+    }
+    std::unordered_map<std::string, uint64_t> loaded;
+    if (!known) 
+    {
+        uint16_t revision;
+        for (const auto& record : findLoader(filename, revision)()) 
+        {
+            loaded[record.key] = hash(record.bytes);
+        }
+    }
+
+    size_t changed = 0; 
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto inserted = baselines.emplace(filename, std::move(loaded));
+        auto& baseline = inserted.first->second;
+
+        std::vector<Change> changes;
+        std::unordered_set<std::string> present;
+        std::vector<uint64_t> hashes;
+        present.reserve(records.size());
+        for (const auto& record : records) 
+        {
+            present.insert(record.key);
+            uint64_t value = hash(record.bytes);
+            auto it = baseline.find(record.key);
+            if (it == baseline.end() || it->second != value) 
+            {
+                changes.push_back(Change{ record.key, false, record.bytes });
+                hashes.push_back(value);
+            }
+        }
+        for (const auto& entry : baseline) 
+        {
+            if (present.count(entry.first) == 0) 
+            {
+                changes.push_back(Change{ entry.first, true, std::string() });
+            }
+        }
+
+        if (changes.empty()) 
+        {
+            return 0;
+        }
+
+        appendFrame(filename, changes);
+
+        Overlay& overlay = active[filename];
+        for (size_t i = 0; i < changes.size(); ++i) 
+        {
+            overlay.apply(changes[i]);
+            if (changes[i].removed) 
+            {
+                baseline.erase(changes[i].key);
+            }
+            else 
+            {
+                baseline[changes[i].key] = hashes[i];
+            }
+        }
+
+        changed = changes.size();
+        pendingChanges += changed;
+        if (pendingChanges >= Config::CHECKPOINT_COMPACT_THRESHOLD && enabled) 
+        {
+            compactRequested = true;
+        }
+    }
+    wakeUp.notify_all();
+    return changed;
+}
+
+bool Checkpoint::hasPending() 
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    return !active.empty() || !frozen.empty();
+}
+
+void Checkpoint::requestCompaction() 
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        compactRequested = true;
+    }
+    wakeUp.notify_all();
+}
+
+bool Checkpoint::compact() 
+{
+    std::lock_guard<std::mutex> compactLock(compactMutex);
+    std::vector<std::string> files; 
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (frozen.empty()) 
+        {
+            if (active.empty()) 
+            {
+                return true;
+            }
+
+            //    ,     
+            std::remove(oldLogFile.c_str());
+            if (std::rename(logFile.c_str(), oldLogFile.c_str()) != 0) 
+            {
+                logger->log(LogLevel::ERR, "Cannot rotate checkpoint log " + logFile);
+                return false;
+            }
+            frozen.swap(active);
+            pendingChanges = 0;
+        }
+
+        for (const auto& entry : frozen) 
+        {
+            files.push_back(entry.first);
+        }
+    }
+
+    //     ,     ,    :
+    //            
+    try 
+    {
+        for (const auto& filename : files) 
+        {
+            uint16_t revision;
+            auto records = findLoader(filename, revision)();
+
+            DataFileWriter writer(filename, revision);
+            for (const auto& record : records) 
+            {
+                writer.record().writeBytes(record.bytes.data(), record.bytes.size());
+                writer.endRecord();
+            }
+            writer.commit();
+            if (!CommitQueue::getInstance()->flush(filename)) 
+            {
+                throw FileIOException("Cannot write snapshot " + filename);
+            }
+        }
+    }
+    catch (const std::exception& e) 
+    {
+        logger->log(LogLevel::ERR, std::string("Checkpoint compaction failed: ") + e.what());
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        frozen.clear();
+        std::remove(oldLogFile.c_str());
+    }
+    logger->log(LogLevel::INFO, "Checkpoint compaction completed, files: " + std::to_string(files.size()));
+    return true;
+}
+
+bool Checkpoint::compactAll() 
+{
+    while (hasPending()) 
+    {
+        if (!compact()) 
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Checkpoint::run() 
+{
+    logger->setConsoleOutput(false);
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) 
+    {
+        wakeUp.wait(lock, [this]() { return stopping || compactRequested; });
+        if (stopping) 
+        {
+            break;
+        }
+        compactRequested = false;
+        lock.unlock();
+
+        compact();
+        lock.lock();
+    }
+}
@@ -0,0 +1,111 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <memory>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <cstdint>
+#include "Config.h"
+#include "Exceptions.h"
+#include "Logger.h"
+
+//    :  .dat  ,    
+//      .      ,
+//            .
+class Checkpoint 
+{
+public:
+    //    ,       
+    struct Change 
+    {
+        std::string key;
+        bool removed;
+        std::string record;
+    };
+
+    struct Record 
+    {
+        std::string key;
+        std::string bytes;
+    };
+
+    class Overlay 
+    {
+    private:
+        std::vector<Change> changes;
+        std::unordered_map<std::string, size_t> positions;
+
+    public:
+        void apply(const Change& change);
+        const Change* find(const std::string& key) const;
+        size_t indexOf(const Change* change) const;
+        const std::vector<Change>& getChanges() const;
+        bool empty() const;
+    };
+
+    //     (   )    
+    using Loader = std::function<std::vector<Record>()>;
+
+private:
+    struct Table 
+    {
+        uint16_t revision;
+        Loader load;
+    };
+
+    static Checkpoint* instance;
+    static std::mutex instanceMutex;
+
+    std::mutex mtx;
+    std::mutex compactMutex;
+    std::condition_variable wakeUp;
+    std::thread worker;
+    std::map<std::string, Table> tables;
+    std::map<std::string, Overlay> active;
+    std::map<std::string, Overlay> frozen;
+    std::map<std::string, std::unordered_map<std::string, uint64_t>> baselines;
+    std::string logFile;
+    std::string oldLogFile;
+    size_t pendingChanges;
+    bool enabled;
+    bool stopping;
+    bool compactRequested;
+    Logger* logger;
+
+    Checkpoint();
+    void run();
+    void replay(const std::string& filename, std::map<std::string, Overlay>& target);
+    void appendFrame(const std::string& filename, const std::vector<Change>& changes);
+    bool hasPending();
+    Loader findLoader(const std::string& filename, uint16_t& revision);
+
+    static uint64_t hash(const std::string& bytes);
+
+public:
+    static Checkpoint* getInstance();
+
+    void track(const std::string& filename, uint16_t revision, Loader load);
+    bool isTracked(const std::string& filename);
+
+    void enable();
+    void disable();
+    bool isEnabled();
+
+    //  ,     ; nullptr,   
+    std::shared_ptr<Overlay> getOverlay(const std::string& filename);
+
+    //         ,   
+    size_t commit(const std::string& filename, const std::vector<Record>& records);
+
+    //     ; compactAll ,    
+    bool compact();
+    bool compactAll();
+    void requestCompaction();
+
+    Checkpoint(const Checkpoint&) = delete;
+    Checkpoint& operator=(const Checkpoint&) = delete;
+};
@@ -0,0 +1,167 @@
+#include "CommitQueue.h"
+#include "DataFile.h"
+
+CommitQueue* CommitQueue::instance = nullptr;
+std::mutex CommitQueue::instanceMutex;
+
+CommitQueue::CommitQueue() : enabled(false), stopping(false), windowMs(0) 
+{
+    logger = Logger::getInstance();
+}
+
+CommitQueue* CommitQueue::getInstance() 
+{
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    if (instance == nullptr) 
+    {
+        instance = new CommitQueue();
+    }
+    return instance;
+}
+
+void CommitQueue::enable(int windowMilliseconds) 
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    if (enabled) 
+    {
+        return;
+    }
+
+    windowMs = windowMilliseconds;
+    stopping = false;
+    enabled = true;
+    worker = std::thread(&CommitQueue::run, this);
+    logger->log(LogLevel::INFO, "Group commit enabled, window: " + std::to_string(windowMs) + " ms");
+}
+
+void CommitQueue::disable() 
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (!enabled) 
+        {
+            return;
+        }
+        enabled = false;
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    worker.join();
+    flush();
+}
+
+bool CommitQueue::isEnabled() 
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    return enabled;
+}
+
+bool CommitQueue::submit(const std::string& filename, std::string& contents) 
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (!enabled) 
+        {
+            return false;
+        }
+        failed.erase(filename);
+        pending[filename].swap(contents);
+    }
+    wakeUp.notify_all();
+    return true;
+}
+
+void CommitQueue::run() 
+{
+    logger->setConsoleOutput(false);
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) 
+    {
+        wakeUp.wait(lock, [this]() { return stopping || !pending.empty(); });
+        if (stopping) 
+        {
+            break;
+        }
+
+        //   ,        
+        wakeUp.wait_for(lock, std::chrono::milliseconds(windowMs), [this]() { return stopping; });
+        lock.unlock();
+
+        //    writeMutex,  flush()     
+        std::lock_guard<std::mutex> writeLock(writeMutex);
+        std::map<std::string, std::string> batch;
+        lock.lock();
+        batch.swap(pending);
+        lock.unlock();
+
+        writeBatch(batch);
+        lock.lock();
+    }
+}
+
+bool CommitQueue::writeBatch(std::map<std::string, std::string>& batch) 
+{
+    bool success = true;
+    for (auto& entry : batch) 
+    {
+        try 
+        {
+            DataFormat::replaceFile(entry.first, entry.second);
+        }
+        catch (const std::exception& e) 
+        {
+            success = false;
+            logger->log(LogLevel::ERR, "Group commit failed for " + entry.first + ": " + e.what());
+
+            //            
+            std::lock_guard<std::mutex> lock(mtx);
+            if (pending.count(entry.first) == 0) 
+            {
+                failed[entry.first].swap(entry.second);
+            }
+        }
+    }
+    return success;
+}
+
+bool CommitQueue::flush() 
+{
+    std::lock_guard<std::mutex> writeLock(writeMutex);
+    std::map<std::string, std::string> batch;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        batch.swap(pending);
+        for (auto& entry : failed) 
+        {
+            batch.emplace(entry.first, std::move(entry.second));
+        }
+        failed.clear();
+    }
+    return writeBatch(batch);
+}
+
+bool CommitQueue::flush(const std::string& filename) 
+{
+    std::lock_guard<std::mutex> writeLock(writeMutex);
+    std::map<std::string, std::string> batch;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = pending.find(filename);
+        if (it == pending.end()) 
+        {
+            it = failed.find(filename);
+            if (it == failed.end()) 
+            {
+                return true;
+            }
+            batch[filename].swap(it->second);
+            failed.erase(it);
+        }
+        else 
+        {
+            batch[filename].swap(it->second);
+            pending.erase(it);
+        }
+    }
+    return writeBatch(batch);
+}
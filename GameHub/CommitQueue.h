@@ -0,0 +1,49 @@
+#pragma once
+#include <string>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include "Config.h"
+#include "Logger.h"
+
+//    . ,    , :
+//         ,   .
+// ,      ,  :    flush,
+//    false,    .
+class CommitQueue 
+{
+private:
+    static CommitQueue* instance;
+    static std::mutex instanceMutex;
+
+    std::mutex mtx;
+    std::mutex writeMutex;
+    std::condition_variable wakeUp;
+    std::map<std::string, std::string> pending;
+    std::map<std::string, std::string> failed;
+    std::thread worker;
+    bool enabled;
+    bool stopping;
+    int windowMs;
+    Logger* logger;
+
+    CommitQueue();
+    void run();
+    bool writeBatch(std::map<std::string, std::string>& batch);
+
+public:
+    static CommitQueue* getInstance();
+
+    void enable(int windowMilliseconds);
+    void disable();
+    bool isEnabled();
+
+    // false,         
+    bool submit(const std::string& filename, std::string& contents);
+    bool flush();
+    bool flush(const std::string& filename);
+
+    CommitQueue(const CommitQueue&) = delete;
+    CommitQueue& operator=(const CommitQueue&) = delete;
+};
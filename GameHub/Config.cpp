@@ -11,16 +11,33 @@ namespace Config
 
     const std::string USERS_FILE = "users.dat";
     const std::string PRODUCTS_FILE = "products.dat";
+    const std::string PRODUCT_DETAILS_FILE = "product_details.dat";
+    const std::string PRODUCT_INDEX_FILE = "products.idx";
     const std::string SALES_FILE = "sales.dat";
     const std::string DISCOUNTS_FILE = "discounts.dat";
     const std::string WISHLISTS_FILE = "wishlists.dat";
     const std::string GENRES_FILE = "genres.dat";
     const std::string TAGS_FILE = "tags.dat";
+    const std::string DICTIONARY_FILE = "strings.dat";
     const std::string LOG_FILE = "system.log";
+    const std::string SEQUENCES_FILE = "sequences.dat";
+    const std::string SALES_JOURNAL_FILE = "sales.journal";
+    const std::string CHECKPOINT_LOG_FILE = "store.delta";
+    const std::string SALES_PARTITIONS_FILE = "sales_partitions.dat";
+    const std::string SALES_PARTITION_PREFIX = "sales_";
 
     const int PAGE_SIZE = 10;
     const int MAX_DISPLAY_WIDTH = 80;
     const std::string DATE_FORMAT = "%d.%m.%Y %H:%M:%S";
+    const int ID_BLOCK_SIZE = 64;
+    const size_t JOURNAL_CHECKPOINT_INTERVAL = 100;
+    const size_t JOURNAL_MAX_RECORD_SIZE = 1024 * 1024;
+    const size_t DATA_BLOCK_RECORDS = 256;
+    const size_t DATA_FILE_MEMORY_BUDGET = 256 * 1024 * 1024;
+    const int GROUP_COMMIT_WINDOW_MS = 200;
+    const size_t CHECKPOINT_COMPACT_THRESHOLD = 1000;
+    const int STARTUP_LOAD_THREADS = 4;
+    const size_t SALES_MEMORY_BUDGET = 64 * 1024 * 1024;
 }
 
 void Config::setColor(int color) 
@@ -45,6 +62,19 @@ std::string Config::getCurrentDateTime()
     return std::string(buffer);
 }
 
+std::time_t Config::parseDateTime(const std::string& dateTime) 
+{
+    std::tm tm = {};
+    std::istringstream stream(dateTime);
+    stream >> std::get_time(&tm, Config::DATE_FORMAT.c_str());
+    if (stream.fail()) 
+    {
+        return -1;
+    }
+    tm.tm_isdst = -1;
+    return std::mktime(&tm);
+}
+
 std::string Config::centerText(const std::string& text, int width) 
 {
     if (text.length() >= width) return text;
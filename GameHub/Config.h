@@ -29,22 +29,40 @@ namespace Config
     //   
     extern const std::string USERS_FILE;
     extern const std::string PRODUCTS_FILE;
+    extern const std::string PRODUCT_DETAILS_FILE;
+    extern const std::string PRODUCT_INDEX_FILE;
     extern const std::string SALES_FILE;
     extern const std::string DISCOUNTS_FILE;
     extern const std::string WISHLISTS_FILE;
     extern const std::string GENRES_FILE;
     extern const std::string TAGS_FILE;
+    extern const std::string DICTIONARY_FILE;
     extern const std::string LOG_FILE;
+    extern const std::string SEQUENCES_FILE;
+    extern const std::string SALES_JOURNAL_FILE;
+    extern const std::string CHECKPOINT_LOG_FILE;
+    extern const std::string SALES_PARTITIONS_FILE;
+    extern const std::string SALES_PARTITION_PREFIX;
 
     // 
     extern const int PAGE_SIZE;
     extern const int MAX_DISPLAY_WIDTH;
     extern const std::string DATE_FORMAT;
+    extern const int ID_BLOCK_SIZE;
+    extern const size_t JOURNAL_CHECKPOINT_INTERVAL;
+    extern const size_t JOURNAL_MAX_RECORD_SIZE;
+    extern const size_t DATA_BLOCK_RECORDS;
+    extern const size_t DATA_FILE_MEMORY_BUDGET;
+    extern const int GROUP_COMMIT_WINDOW_MS;
+    extern const size_t CHECKPOINT_COMPACT_THRESHOLD;
+    extern const int STARTUP_LOAD_THREADS;
+    extern const size_t SALES_MEMORY_BUDGET;
 
     void setColor(int color);
     void resetColor();
 
     std::string getCurrentDateTime();
+    std::time_t parseDateTime(const std::string& dateTime);
 
     std::string centerText(const std::string& text, int width);
 }
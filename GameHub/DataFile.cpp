@@ -0,0 +1,506 @@
+#include "DataFile.h"
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <io.h>
+#include "CommitQueue.h"
+
+namespace 
+{
+    //     : CRC   8    (slicing-by-8)
+    std::vector<uint32_t> buildCrcTable() 
+    {
+        std::vector<uint32_t> table(8 * 256);
+        for (uint32_t i = 0; i < 256; ++i) 
+        {
+            uint32_t value = i;
+            for (int bit = 0; bit < 8; ++bit) 
+            {
+                value = (value & 1) ? (0xEDB88320u ^ (value >> 1)) : (value >> 1);
+            }
+            table[i] = value;
+        }
+        for (uint32_t i = 0; i < 256; ++i) 
+        {
+            for (size_t slice = 1; slice < 8; ++slice) 
+            {
+                uint32_t previous = table[(slice - 1) * 256 + i];
+                table[slice * 256 + i] = table[previous & 0xFF] ^ (previous >> 8);
+            }
+        }
+        return table;
+    }
+}
+
+uint32_t DataFormat::crc32(const char* data, size_t size) 
+{
+    static const std::vector<uint32_t> table = buildCrcTable();
+
+    const uint32_t* t = table.data();
+
+    uint32_t crc = 0xFFFFFFFFu;
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+    while (size >= 8) 
+    {
+        uint32_t low = crc ^ (bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (static_cast<uint32_t>(bytes[3]) << 24));
+        uint32_t high = bytes[4] | (bytes[5] << 8) | (bytes[6] << 16) | (static_cast<uint32_t>(bytes[7]) << 24);
+        crc = t[7 * 256 + (low & 0xFF)] ^ t[6 * 256 + ((low >> 8) & 0xFF)] ^
+            t[5 * 256 + ((low >> 16) & 0xFF)] ^ t[4 * 256 + (low >> 24)] ^
+            t[3 * 256 + (high & 0xFF)] ^ t[2 * 256 + ((high >> 8) & 0xFF)] ^
+            t[1 * 256 + ((high >> 16) & 0xFF)] ^ t[high >> 24];
+        bytes += 8;
+        size -= 8;
+    }
+    while (size-- > 0) 
+    {
+        crc = t[(crc ^ *bytes++) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+std::string DataFormat::makeHeader(uint16_t schemaRevision, uint64_t recordCount, uint64_t dataSize, uint32_t blockCount) 
+{
+    std::string header;
+    header.reserve(HEADER_SIZE);
+    putU32(header, MAGIC);
+    putU16(header, VERSION);
+    putU16(header, schemaRevision);
+    putU64(header, recordCount);
+    putU64(header, dataSize);
+    putU32(header, blockCount);
+    putU32(header, crc32(header.data(), header.size()));
+    return header;
+}
+
+void DataFormat::appendBlock(std::string& out, uint32_t recordCount, const char* payload, size_t size) 
+{
+    putU32(out, recordCount);
+    putU32(out, static_cast<uint32_t>(size));
+    putU32(out, crc32(payload, size));
+    out.append(payload, size);
+}
+
+void DataFormat::replaceFile(const std::string& filename, const std::string& contents) 
+{
+    //          ,    
+    // ,        ,    
+    std::string tempName = filename + ".tmp";
+    FILE* file = nullptr;
+    if (fopen_s(&file, tempName.c_str(), "wb") != 0 || !file) 
+    {
+        throw FileIOException("Cannot open file for writing: " + tempName);
+    }
+
+    bool written = fwrite(contents.data(), 1, contents.size(), file) == contents.size() &&
+        fflush(file) == 0 && _commit(_fileno(file)) == 0;
+    written = (fclose(file) == 0) && written;
+    if (!written) 
+    {
+        std::remove(tempName.c_str());
+        throw FileIOException("Cannot write file: " + tempName);
+    }
+
+    if (!MoveFileExA(tempName.c_str(), filename.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) 
+    {
+        std::remove(tempName.c_str());
+        throw FileIOException("Cannot replace file: " + filename);
+    }
+}
+
+void DataFormat::putU16(std::string& out, uint16_t value) 
+{
+    for (int i = 0; i < 2; ++i) 
+    {
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+void DataFormat::putU32(std::string& out, uint32_t value) 
+{
+    for (int i = 0; i < 4; ++i) 
+    {
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+void DataFormat::putU64(std::string& out, uint64_t value) 
+{
+    for (int i = 0; i < 8; ++i) 
+    {
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+uint16_t DataFormat::getU16(const char* in) 
+{
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(in);
+    return static_cast<uint16_t>(bytes[0] | (bytes[1] << 8));
+}
+
+uint32_t DataFormat::getU32(const char* in) 
+{
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(in);
+    uint32_t value = 0;
+    for (int i = 3; i >= 0; --i) 
+    {
+        value = (value << 8) | bytes[i];
+    }
+    return value;
+}
+
+uint64_t DataFormat::getU64(const char* in) 
+{
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(in);
+    uint64_t value = 0;
+    for (int i = 7; i >= 0; --i) 
+    {
+        value = (value << 8) | bytes[i];
+    }
+    return value;
+}
+
+DataFileWriter::DataFileWriter(const std::string& filename, uint16_t schemaRevision)
+    : filename(filename), schemaRevision(schemaRevision), blockRecords(0), blockCount(0), recordCount(0) {}
+
+BinaryWriter& DataFileWriter::record() 
+{
+    return block;
+}
+
+void DataFileWriter::endRecord() 
+{
+    blockRecords++;
+    recordCount++;
+    if (blockRecords >= Config::DATA_BLOCK_RECORDS) 
+    {
+        flushBlock();
+    }
+}
+
+void DataFileWriter::flushBlock() 
+{
+    if (blockRecords == 0) 
+    {
+        return;
+    }
+
+    DataFormat::appendBlock(blocks, blockRecords, block.data(), block.size());
+
+    block.clear();
+    blockRecords = 0;
+    blockCount++;
+}
+
+void DataFileWriter::commit() 
+{
+    flushBlock();
+
+    std::string contents = DataFormat::makeHeader(schemaRevision, recordCount, blocks.size(), blockCount);
+    contents.append(blocks);
+    blocks.clear();
+
+    if (!CommitQueue::getInstance()->submit(filename, contents)) 
+    {
+        DataFormat::replaceFile(filename, contents);
+    }
+}
+
+DataFileAppender::DataFileAppender(const std::string& filename, uint16_t schemaRevision)
+    : filename(filename), schemaRevision(schemaRevision), blockRecords(0) {}
+
+BinaryWriter& DataFileAppender::record() 
+{
+    return block;
+}
+
+void DataFileAppender::endRecord() 
+{
+    blockRecords++;
+}
+
+bool DataFileAppender::commit(bool sync) 
+{
+    if (blockRecords == 0) 
+    {
+        return true;
+    }
+
+    //     ,      
+    if (!CommitQueue::getInstance()->flush(filename)) 
+    {
+        throw FileIOException("Cannot write pending contents of " + filename);
+    }
+
+    FILE* file = nullptr;
+    if (fopen_s(&file, filename.c_str(), "r+b") != 0 || !file) 
+    {
+        return false;
+    }
+
+    char header[DataFormat::HEADER_SIZE];
+    size_t headerRead = fread(header, 1, sizeof(header), file);
+    if (headerRead < 6 || DataFormat::getU32(header) != DataFormat::MAGIC || DataFormat::getU16(header + 4) < DataFormat::VERSION) 
+    {
+        fclose(file);
+        return false;
+    }
+    if (headerRead < sizeof(header) || DataFormat::getU16(header + 4) != DataFormat::VERSION ||
+        DataFormat::getU32(header + 28) != DataFormat::crc32(header, 28)) 
+    {
+        fclose(file);
+        throw FileIOException("Cannot append to " + filename + ": damaged or unsupported header");
+    }
+
+    //      ,   
+    if ((std::max)(DataFormat::getU16(header + 6), static_cast<uint16_t>(1)) != schemaRevision) 
+    {
+        fclose(file);
+        return false;
+    }
+
+    uint64_t recordCount = DataFormat::getU64(header + 8);
+    uint64_t dataSize = DataFormat::getU64(header + 16);
+    uint32_t blockCount = DataFormat::getU32(header + 24);
+
+    std::string frame;
+    DataFormat::appendBlock(frame, blockRecords, block.data(), block.size());
+
+    //  ,  :       
+    bool written = _fseeki64(file, static_cast<long long>(DataFormat::HEADER_SIZE + dataSize), SEEK_SET) == 0 &&
+        fwrite(frame.data(), 1, frame.size(), file) == frame.size() && fflush(file) == 0 &&
+        (!sync || _commit(_fileno(file)) == 0);
+
+    if (written) 
+    {
+        std::string newHeader = DataFormat::makeHeader(schemaRevision, recordCount + blockRecords, dataSize + frame.size(), blockCount + 1);
+        written = _fseeki64(file, 0, SEEK_SET) == 0 &&
+            fwrite(newHeader.data(), 1, newHeader.size(), file) == newHeader.size() && fflush(file) == 0 &&
+            (!sync || _commit(_fileno(file)) == 0);
+    }
+
+    fclose(file);
+    if (!written) 
+    {
+        throw FileIOException("Cannot append to " + filename);
+    }
+
+    block.clear();
+    blockRecords = 0;
+    return true;
+}
+
+DataFileReader::DataFileReader(const std::string& filename)
+    : filename(filename), base(nullptr), fileSize(0), found(false), legacy(false), schemaRevision(1),
+    recordCount(0), currentBlock(0), recordsLeftInBlock(0) 
+{
+    CommitQueue::getInstance()->flush(filename);
+    if (!mapped.open(filename)) 
+    {
+        return;
+    }
+    found = true;
+    base = mapped.data();
+    fileSize = mapped.size();
+
+    if (static_cast<uint64_t>(fileSize) > Config::DATA_FILE_MEMORY_BUDGET) 
+    {
+        fail("file size " + std::to_string(fileSize) + " exceeds memory budget");
+    }
+
+    if (fileSize >= 4 && DataFormat::getU32(base) == DataFormat::MAGIC) 
+    {
+        parseHeader();
+    }
+    else 
+    {
+        parseLegacy();
+    }
+
+    blockReader.reset(base, base);
+}
+
+void DataFileReader::fail(const std::string& reason) const 
+{
+    throw FileIOException("Corrupted data file " + filename + ": " + reason);
+}
+
+void DataFileReader::parseHeader() 
+{
+    if (fileSize < 6) 
+    {
+        fail("truncated header");
+    }
+
+    const char* header = base;
+    uint16_t version = DataFormat::getU16(header + 4);
+    if (version == 0 || version > DataFormat::VERSION) 
+    {
+        fail("unsupported format version " + std::to_string(version));
+    }
+
+    //  1    ,       
+    size_t headerSize = version == 1 ? DataFormat::HEADER_SIZE_V1 : DataFormat::HEADER_SIZE;
+    if (fileSize < headerSize) 
+    {
+        fail("truncated header");
+    }
+    if (DataFormat::getU32(header + headerSize - 4) != DataFormat::crc32(header, headerSize - 4)) 
+    {
+        fail("header checksum mismatch");
+    }
+
+    recordCount = DataFormat::getU64(header + 8);
+    uint64_t dataSize = fileSize - headerSize;
+    uint32_t blockCount;
+    if (version == 1) 
+    {
+        blockCount = DataFormat::getU32(header + 16);
+    }
+    else 
+    {
+        // ,     ,   0     
+        schemaRevision = (std::max)(DataFormat::getU16(header + 6), static_cast<uint16_t>(1));
+        dataSize = DataFormat::getU64(header + 16);
+        blockCount = DataFormat::getU32(header + 24);
+        if (dataSize > fileSize - headerSize) 
+        {
+            fail("truncated data");
+        }
+    }
+    size_t dataEnd = headerSize + static_cast<size_t>(dataSize);
+
+    //      ,       
+    size_t offset = headerSize;
+    uint64_t totalRecords = 0;
+    blocks.reserve((std::min)(static_cast<size_t>(blockCount), fileSize / DataFormat::BLOCK_HEADER_SIZE));
+    for (uint32_t i = 0; i < blockCount; ++i) 
+    {
+        if (dataEnd - offset < DataFormat::BLOCK_HEADER_SIZE) 
+        {
+            fail("truncated block header");
+        }
+
+        Block block;
+        block.recordCount = DataFormat::getU32(base + offset);
+        block.size = DataFormat::getU32(base + offset + 4);
+        uint32_t crc = DataFormat::getU32(base + offset + 8);
+        block.offset = offset + DataFormat::BLOCK_HEADER_SIZE;
+
+        if (dataEnd - block.offset < block.size) 
+        {
+            fail("truncated block");
+        }
+        if (block.recordCount > block.size) 
+        {
+            fail("block record count exceeds block size");
+        }
+        if (DataFormat::crc32(base + block.offset, block.size) != crc) 
+        {
+            fail("block checksum mismatch");
+        }
+
+        totalRecords += block.recordCount;
+        blocks.push_back(block);
+        offset = block.offset + block.size;
+    }
+
+    if (offset != dataEnd) 
+    {
+        fail("block sizes do not match data size");
+    }
+    if (totalRecords != recordCount) 
+    {
+        fail("record count does not match blocks");
+    }
+}
+
+void DataFileReader::parseLegacy() 
+{
+    //    : size_t      
+    legacy = true;
+    if (fileSize == 0) 
+    {
+        return;
+    }
+    if (fileSize < sizeof(size_t)) 
+    {
+        fail("truncated record count");
+    }
+
+    size_t count;
+    std::memcpy(&count, base, sizeof(count));
+
+    Block block;
+    block.offset = sizeof(size_t);
+    block.size = fileSize - block.offset;
+    block.recordCount = count;
+    if (block.recordCount > block.size) 
+    {
+        fail("record count " + std::to_string(count) + " exceeds file size");
+    }
+
+    recordCount = count;
+    blocks.push_back(block);
+}
+
+bool DataFileReader::exists() const { return found; }
+bool DataFileReader::isLegacy() const { return legacy; }
+size_t DataFileReader::getRecordCount() const { return static_cast<size_t>(recordCount); }
+uint16_t DataFileReader::getSchemaRevision() const { return schemaRevision; }
+
+void DataFileReader::checkBlockConsumed() const 
+{
+    if (!legacy && blockReader.remaining() != 0) 
+    {
+        fail("unread data at the end of block");
+    }
+}
+
+BinaryReader& DataFileReader::nextRecord() 
+{
+    while (recordsLeftInBlock == 0) 
+    {
+        if (currentBlock > 0) 
+        {
+            checkBlockConsumed();
+        }
+        if (currentBlock >= blocks.size()) 
+        {
+            fail("more records requested than stored");
+        }
+
+        const Block& block = blocks[currentBlock++];
+        blockReader.reset(base + block.offset, base + block.offset + block.size);
+        recordsLeftInBlock = block.recordCount;
+    }
+
+    recordsLeftInBlock--;
+    return blockReader;
+}
+
+void DataFileReader::finish() 
+{
+    if (currentBlock > 0) 
+    {
+        checkBlockConsumed();
+    }
+}
+
+const char* DataFileReader::position() const 
+{
+    return blockReader.position();
+}
+
+const char* DataFileReader::blockEnd() const 
+{
+    return blockReader.end();
+}
+
+void DataFileReader::skip(size_t bytes) 
+{
+    if (bytes > blockReader.remaining()) 
+    {
+        fail("record extends beyond its block");
+    }
+    blockReader.skip(bytes);
+}
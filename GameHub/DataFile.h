@@ -0,0 +1,118 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include "Config.h"
+#include "Exceptions.h"
+#include "MappedFile.h"
+#include "BinaryCodec.h"
+
+//   :  (, ,   ,  ,  ,  , CRC )
+//   ,     CRC.     -  , little-endian.
+//            .
+namespace DataFormat 
+{
+    const uint32_t MAGIC = 0x42444847;
+    const uint16_t VERSION = 2;
+    const size_t HEADER_SIZE = 32;
+    const size_t HEADER_SIZE_V1 = 24;
+    const size_t BLOCK_HEADER_SIZE = 12;
+    const size_t MAX_TYPE_LENGTH = 32;
+
+    uint32_t crc32(const char* data, size_t size);
+    std::string makeHeader(uint16_t schemaRevision, uint64_t recordCount, uint64_t dataSize, uint32_t blockCount);
+    void appendBlock(std::string& out, uint32_t recordCount, const char* payload, size_t size);
+    void replaceFile(const std::string& filename, const std::string& contents);
+
+    void putU16(std::string& out, uint16_t value);
+    void putU32(std::string& out, uint32_t value);
+    void putU64(std::string& out, uint64_t value);
+    uint16_t getU16(const char* in);
+    uint32_t getU32(const char* in);
+    uint64_t getU64(const char* in);
+}
+
+class DataFileWriter 
+{
+private:
+    std::string filename;
+    uint16_t schemaRevision;
+    std::string blocks;
+    BinaryWriter block;
+    uint32_t blockRecords;
+    uint32_t blockCount;
+    uint64_t recordCount;
+
+    void flushBlock();
+
+public:
+    DataFileWriter(const std::string& filename, uint16_t schemaRevision);
+
+    BinaryWriter& record();
+    void endRecord();
+    void commit();
+};
+
+class DataFileAppender 
+{
+private:
+    std::string filename;
+    uint16_t schemaRevision;
+    BinaryWriter block;
+    uint32_t blockRecords;
+
+public:
+    DataFileAppender(const std::string& filename, uint16_t schemaRevision);
+
+    BinaryWriter& record();
+    void endRecord();
+
+    // false,   ,             
+    bool commit(bool sync);
+};
+
+class DataFileReader 
+{
+private:
+    struct Block 
+    {
+        size_t offset;
+        size_t size;
+        uint64_t recordCount;
+    };
+
+    std::string filename;
+    MappedFile mapped;
+    const char* base;
+    size_t fileSize;
+    std::vector<Block> blocks;
+    BinaryReader blockReader;
+    bool found;
+    bool legacy;
+    uint16_t schemaRevision;
+    uint64_t recordCount;
+    size_t currentBlock;
+    uint64_t recordsLeftInBlock;
+
+    void parseHeader();
+    void parseLegacy();
+    void checkBlockConsumed() const;
+    void fail(const std::string& reason) const;
+
+public:
+    explicit DataFileReader(const std::string& filename);
+
+    bool exists() const;
+    bool isLegacy() const;
+    size_t getRecordCount() const;
+    uint16_t getSchemaRevision() const;
+
+    BinaryReader& nextRecord();
+    void finish();
+
+    //         
+    const char* position() const;
+    const char* blockEnd() const;
+    void skip(size_t bytes);
+};
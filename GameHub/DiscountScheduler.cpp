@@ -0,0 +1,93 @@
+#include "DiscountScheduler.h"
+#include <limits>
+#include "Store.h"
+
+DiscountScheduler::DiscountScheduler() : epoch(0), nextBoundary(0) {}
+
+void DiscountScheduler::updateNextBoundary() 
+{
+    nextBoundary = (std::numeric_limits<std::time_t>::max)();
+    if (!pendingStarts.empty()) 
+    {
+        nextBoundary = pendingStarts.begin()->first;
+    }
+    if (!pendingEnds.empty()) 
+    {
+        //       
+        nextBoundary = (std::min)(nextBoundary, pendingEnds.begin()->first + 1);
+    }
+}
+
+void DiscountScheduler::schedule(const std::vector<Discount>& discounts, std::time_t now) 
+{
+    pendingStarts.clear();
+    pendingEnds.clear();
+    activeDiscounts.clear();
+    endTimes.assign(discounts.size(), 0);
+
+    for (size_t i = 0; i < discounts.size(); ++i) 
+    {
+        if (!discounts[i].startDate.isSet() || !discounts[i].endDate.isSet()) 
+        {
+            continue;
+        }
+        std::time_t start = static_cast<std::time_t>(discounts[i].startDate.getSeconds());
+        std::time_t end = static_cast<std::time_t>(discounts[i].endDate.getSeconds());
+        if (end < start || end < now) 
+        {
+            continue;
+        }
+        endTimes[i] = end;
+        pendingStarts.insert({ start, i });
+    }
+
+    epoch++;
+    nextBoundary = 0;
+    advance(now);
+}
+
+bool DiscountScheduler::advance(std::time_t now) 
+{
+    if (now < nextBoundary) 
+    {
+        return false;
+    }
+
+    bool changed = false;
+    while (!pendingStarts.empty() && pendingStarts.begin()->first <= now) 
+    {
+        size_t index = pendingStarts.begin()->second;
+        pendingStarts.erase(pendingStarts.begin());
+        if (endTimes[index] < now) 
+        {
+            continue;
+        }
+        pendingEnds.insert({ endTimes[index], index });
+        activeDiscounts.insert(index);
+        changed = true;
+    }
+
+    while (!pendingEnds.empty() && pendingEnds.begin()->first < now) 
+    {
+        activeDiscounts.erase(pendingEnds.begin()->second);
+        pendingEnds.erase(pendingEnds.begin());
+        changed = true;
+    }
+
+    updateNextBoundary();
+    if (changed) 
+    {
+        epoch++;
+    }
+    return changed;
+}
+
+const std::set<size_t>& DiscountScheduler::getActiveDiscounts() const 
+{
+    return activeDiscounts;
+}
+
+unsigned long DiscountScheduler::getEpoch() const 
+{
+    return epoch;
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <ctime>
+#include "Config.h"
+
+struct Discount;
+
+//  :       ,
+//      ,    
+//     ,    ,  .
+class DiscountScheduler 
+{
+private:
+    std::multimap<std::time_t, size_t> pendingStarts;
+    std::multimap<std::time_t, size_t> pendingEnds;
+    std::vector<std::time_t> endTimes;
+    std::set<size_t> activeDiscounts;
+    unsigned long epoch;
+    std::time_t nextBoundary;
+
+    void updateNextBoundary();
+
+public:
+    DiscountScheduler();
+
+    void schedule(const std::vector<Discount>& discounts, std::time_t now);
+    bool advance(std::time_t now);
+
+    const std::set<size_t>& getActiveDiscounts() const;
+    unsigned long getEpoch() const;
+};
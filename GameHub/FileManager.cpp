@@ -1,10 +1,69 @@
 #include "FileManager.h"
 #include "Store.h"
 #include "Wishlist.h"
+#include "CommitQueue.h"
+
+//        ,      
+static const uint16_t USER_SCHEMA_REVISION = Schema::revision<Customer>();
+
+template<typename T>
+static void trackFile(const std::string& filename) 
+{
+    Checkpoint::getInstance()->track(filename, RecordFormat<T>::revision(), [filename]() 
+    {
+        FileManager fileManager;
+        return fileManager.encodeRecords(fileManager.readRecords<T>(filename));
+    });
+}
+
+// ,         .
+//  ,      -  .
+static void trackStoreFiles() 
+{
+    trackFile<std::shared_ptr<Product>>(Config::PRODUCTS_FILE);
+    // sales.dat   :     ,   
+    // ,        
+    trackFile<Sale>(Config::SALES_FILE);
+    trackFile<Discount>(Config::DISCOUNTS_FILE);
+    trackFile<Wishlist::WishlistItem>(Config::WISHLISTS_FILE);
+    trackFile<std::shared_ptr<User>>(Config::USERS_FILE);
+}
+
+static std::once_flag storeFilesTracked;
 
 FileManager::FileManager() 
 {
     logger = Logger::getInstance();
+    std::call_once(storeFilesTracked, trackStoreFiles);
+}
+
+void FileManager::setGroupCommit(bool enabled) 
+{
+    if (enabled) 
+    {
+        CommitQueue::getInstance()->enable(Config::GROUP_COMMIT_WINDOW_MS);
+    }
+    else 
+    {
+        CommitQueue::getInstance()->disable();
+    }
+}
+
+bool FileManager::flushPendingWrites() 
+{
+    return CommitQueue::getInstance()->flush();
+}
+
+void FileManager::setCheckpointing(bool enabled) 
+{
+    if (enabled) 
+    {
+        Checkpoint::getInstance()->enable();
+    }
+    else 
+    {
+        Checkpoint::getInstance()->disable();
+    }
 }
 
 std::vector<std::string> FileManager::loadStringList(const std::string& filename) 
@@ -17,36 +76,52 @@ bool FileManager::saveStringList(const std::string& filename, const std::vector<
     return saveToFile<std::string>(filename, list);
 }
 
-bool FileManager::appendToStringList(const std::string& filename, const std::string& item) 
+bool FileManager::appendToStringList(const std::string& filename, const std::string& item, bool sync) 
 {
-    auto list = loadStringList(filename);
-    list.push_back(item);
-    return saveStringList(filename, list);
+    return appendToStringList(filename, std::vector<std::string>{ item }, sync);
 }
 
-template<>
-bool FileManager::saveToFile<std::string>(const std::string& filename, const std::vector<std::string>& data)
+bool FileManager::appendToStringList(const std::string& filename, const std::vector<std::string>& items, bool sync) 
 {
     try 
     {
-        std::ofstream file(filename, std::ios::binary);
-        if (!file.is_open()) 
+        DataFileAppender appender(filename, Schema::BASE_REVISION);
+        for (const auto& item : items) 
+        {
+            appender.record().writeString(item);
+            appender.endRecord();
+        }
+        if (appender.commit(sync)) 
         {
-            throw FileIOException("Cannot open file for writing: " + filename);
+            logger->log(LogLevel::INFO, "Strings appended to " + filename + ", items: " + std::to_string(items.size()));
+            return true;
         }
+    }
+    catch (const std::exception& e) 
+    {
+        logger->log(LogLevel::ERR, "Failed to append string to " + filename + ": " + e.what());
+        return false;
+    }
 
-        size_t size = data.size();
-        file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    auto list = loadStringList(filename);
+    list.insert(list.end(), items.begin(), items.end());
+    return saveStringList(filename, list);
+}
 
+template<>
+bool FileManager::saveToFile<std::string>(const std::string& filename, const std::vector<std::string>& data)
+{
+    try 
+    {
+        DataFileWriter writer(filename, Schema::BASE_REVISION);
         for (const auto& str : data)
         {
-            size_t strSize = str.size();
-            file.write(reinterpret_cast<const char*>(&strSize), sizeof(strSize));
-            file.write(str.c_str(), strSize);
+            writer.record().writeString(str);
+            writer.endRecord();
         }
+        writer.commit();
 
-        file.close();
-        logger->log(LogLevel::INFO, "String list saved to " + filename + ", items: " + std::to_string(size));
+        logger->log(LogLevel::INFO, "String list saved to " + filename + ", items: " + std::to_string(data.size()));
         return true;
     }
     catch (const std::exception& e) 
@@ -62,192 +137,108 @@ std::vector<std::string> FileManager::loadFromFile<std::string>(const std::strin
     std::vector<std::string> data;
     try 
     {
-        std::ifstream file(filename, std::ios::binary);
-        if (!file.is_open()) 
+        DataFileReader reader(filename);
+        if (!reader.exists()) 
         {
             return data;
         }
 
-        size_t size;
-        file.read(reinterpret_cast<char*>(&size), sizeof(size));
-
+        size_t size = reader.getRecordCount();
         data.resize(size);
         for (size_t i = 0; i < size; ++i) 
         {
-            size_t strSize;
-            file.read(reinterpret_cast<char*>(&strSize), sizeof(strSize));
-
-            std::string str(strSize, ' ');
-            file.read(&str[0], strSize);
-            data[i] = str;
+            reader.nextRecord().readString(data[i]);
         }
+        reader.finish();
 
-        file.close();
         logger->log(LogLevel::INFO, "String list loaded from " + filename + ", items: " + std::to_string(size));
     }
     catch (const std::exception& e) 
     {
+        data.clear();
         logger->log(LogLevel::ERR, "Failed to load string list from " + filename + ": " + e.what());
     }
     return data;
 }
 
-template<>
-bool FileManager::saveToFile<std::shared_ptr<Product>>(const std::string& filename, const std::vector<std::shared_ptr<Product>>& data) 
+uint16_t RecordFormat<std::shared_ptr<Product>>::revision() 
 {
-    try 
-    {
-        std::ofstream file(filename, std::ios::binary);
-        if (!file.is_open()) 
-        {
-            throw FileIOException("Cannot open file for writing: " + filename);
-        }
-
-        size_t size = data.size();
-        file.write(reinterpret_cast<const char*>(&size), sizeof(size));
-
-        for (const auto& product : data) 
-        {
-            std::string productType = product->getProductType();
-            size_t typeSize = productType.size();
-            file.write(reinterpret_cast<const char*>(&typeSize), sizeof(typeSize));
-            file.write(productType.c_str(), typeSize);
-
-            product->serialize(file);
-        }
+    return Schema::revision<Product>();
+}
 
-        file.close();
-        logger->log(LogLevel::INFO, "Products saved to " + filename + ", count: " + std::to_string(size));
-        return true;
-    }
-    catch (const std::exception& e) 
-    {
-        logger->log(LogLevel::ERR, "Failed to save products to " + filename + ": " + e.what());
-        return false;
-    }
+void RecordFormat<std::shared_ptr<Product>>::write(BinaryWriter& out, const std::shared_ptr<Product>& product) 
+{
+    out.writeString(product->getProductType());
+    product->serialize(out);
 }
 
-template<>
-std::vector<std::shared_ptr<Product>> FileManager::loadFromFile<std::shared_ptr<Product>>(const std::string& filename) 
+void RecordFormat<std::shared_ptr<Product>>::read(BinaryReader& in, std::shared_ptr<Product>& product, uint16_t revision) 
 {
-    std::vector<std::shared_ptr<Product>> products;
-    try 
+    StringRef productType = in.readStringRef();
+    if (productType.size > DataFormat::MAX_TYPE_LENGTH) 
     {
-        std::ifstream file(filename, std::ios::binary);
-        if (!file.is_open())
-        {
-            return products;
-        }
-
-        size_t size;
-        file.read(reinterpret_cast<char*>(&size), sizeof(size));
-
-        for (size_t i = 0; i < size; ++i) 
-        {
-            size_t typeSize;
-            file.read(reinterpret_cast<char*>(&typeSize), sizeof(typeSize));
-            std::string productType(typeSize, ' ');
-            file.read(&productType[0], typeSize);
-
-            std::shared_ptr<Product> product;
-            if (productType == "Game") 
-            {
-                product = std::make_shared<Game>();
-            }
-
-            product->deserialize(file);
-            products.push_back(product);
-        }
+        throw FileIOException("Corrupted product type");
+    }
 
-        file.close();
-        logger->log(LogLevel::INFO, "Products loaded from " + filename + ", count: " + std::to_string(size));
+    if (productType == "Game") 
+    {
+        product = std::make_shared<Game>();
     }
-    catch (const std::exception& e) 
+    else 
     {
-        logger->log(LogLevel::ERR, "Failed to load products from " + filename + ": " + e.what());
+        throw FileIOException("Unknown product type: " + productType.str());
     }
-    return products;
+    product->deserialize(in, revision);
 }
 
-template<>
-bool FileManager::saveToFile<std::shared_ptr<User>>(const std::string& filename, const std::vector<std::shared_ptr<User>>& data) 
+uint16_t RecordFormat<std::shared_ptr<User>>::revision() 
 {
-    try
-    {
-        std::ofstream file(filename, std::ios::binary);
-        if (!file.is_open()) 
-        {
-            throw FileIOException("    : " + filename);
-        }
-
-        size_t size = data.size();
-        file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    return USER_SCHEMA_REVISION;
+}
 
-        for (const auto& user : data) 
-        {
-            std::string userType = (user->getRole() == "admin") ? "admin" : "customer";
-            size_t typeSize = userType.size();
-            file.write(reinterpret_cast<const char*>(&typeSize), sizeof(typeSize));
-            file.write(userType.c_str(), typeSize);
+void RecordFormat<std::shared_ptr<User>>::write(BinaryWriter& out, const std::shared_ptr<User>& user) 
+{
+    out.writeString((user->getRole() == "admin") ? "admin" : "customer");
+    user->serialize(out);
+}
 
-            user->serialize(file);
-        }
+void RecordFormat<std::shared_ptr<User>>::read(BinaryReader& in, std::shared_ptr<User>& user, uint16_t revision) 
+{
+    StringRef userType = in.readStringRef();
+    if (userType.size > DataFormat::MAX_TYPE_LENGTH) 
+    {
+        throw FileIOException("Corrupted user type");
+    }
 
-        file.close();
-        logger->log(LogLevel::INFO, "Users saved to " + filename + ", count: " + std::to_string(size));
-        return true;
+    if (userType == "admin") 
+    {
+        user = std::make_shared<Admin>();
     }
-    catch (const std::exception& e) 
+    else 
     {
-        logger->log(LogLevel::ERR, "Failed to save users to " + filename + ": " + e.what());
-        return false;
+        user = std::make_shared<Customer>();
     }
+    user->deserialize(in, revision);
 }
 
-template<>
-std::vector<std::shared_ptr<User>> FileManager::loadFromFile<std::shared_ptr<User>>(const std::string& filename) 
+std::string RecordKey<std::shared_ptr<Product>>::of(const std::shared_ptr<Product>& product, size_t) 
 {
-    std::vector<std::shared_ptr<User>> users;
-    try 
-    {
-        std::ifstream file(filename, std::ios::binary);
-        if (!file.is_open()) 
-        {
-            return users;
-        }
+    return std::to_string(product->getId());
+}
 
-        size_t size;
-        file.read(reinterpret_cast<char*>(&size), sizeof(size));
+std::string RecordKey<std::shared_ptr<User>>::of(const std::shared_ptr<User>& user, size_t) 
+{
+    return std::to_string(user->getId());
+}
 
-        for (size_t i = 0; i < size; ++i) 
-        {
-            size_t typeSize;
-            file.read(reinterpret_cast<char*>(&typeSize), sizeof(typeSize));
-            std::string userType(typeSize, ' ');
-            file.read(&userType[0], typeSize);
-
-            std::shared_ptr<User> user;
-            if (userType == "admin") 
-            {
-                user = std::make_shared<Admin>();
-            }
-            else 
-            {
-                user = std::make_shared<Customer>();
-            }
-
-            user->deserialize(file);
-            users.push_back(user);
-        }
+std::string RecordKey<Sale>::of(const Sale& sale, size_t) 
+{
+    return std::to_string(sale.getSaleId());
+}
 
-        file.close();
-        logger->log(LogLevel::INFO, "Users loaded from " + filename + ", count: " + std::to_string(size));
-    }
-    catch (const std::exception& e) 
-    {
-        logger->log(LogLevel::ERR, "Failed to load users from " + filename + ": " + e.what());
-    }
-    return users;
+std::string RecordKey<Wishlist::WishlistItem>::of(const Wishlist::WishlistItem& item, size_t) 
+{
+    return std::to_string(item.customerId) + ":" + std::to_string(item.productId);
 }
 
 template bool FileManager::saveToFile<Sale>(const std::string&, const std::vector<Sale>&);
@@ -6,6 +6,10 @@
 #include "Config.h"
 #include "Exceptions.h"
 #include "Logger.h"
+#include "DataFile.h"
+#include "Schema.h"
+#include "StringDictionary.h"
+#include "Checkpoint.h"
 
 class User;
 class Product;
@@ -14,11 +18,102 @@ class Game;
 class Admin;
 class Customer;
 
+//       :  ,     
+template<typename T>
+struct RecordFormat 
+{
+    static uint16_t revision() { return Schema::revision<T>(); }
+    static void write(BinaryWriter& out, const T& item) { Schema::write(out, item); }
+    static void read(BinaryReader& in, T& item, uint16_t revision) { Schema::read(in, item, revision); }
+};
+
+template<>
+struct RecordFormat<std::shared_ptr<Product>> 
+{
+    static uint16_t revision();
+    static void write(BinaryWriter& out, const std::shared_ptr<Product>& product);
+    static void read(BinaryReader& in, std::shared_ptr<Product>& product, uint16_t revision);
+};
+
+template<>
+struct RecordFormat<std::shared_ptr<User>> 
+{
+    static uint16_t revision();
+    static void write(BinaryWriter& out, const std::shared_ptr<User>& user);
+    static void read(BinaryReader& in, std::shared_ptr<User>& user, uint16_t revision);
+};
+
+//      .         
+template<typename T>
+struct RecordKey 
+{
+    static std::string of(const T&, size_t position) { return std::to_string(position); }
+};
+
+template<>
+struct RecordKey<std::shared_ptr<Product>> 
+{
+    static std::string of(const std::shared_ptr<Product>& product, size_t position);
+};
+
+template<>
+struct RecordKey<std::shared_ptr<User>> 
+{
+    static std::string of(const std::shared_ptr<User>& user, size_t position);
+};
+
+template<>
+struct RecordKey<Sale> 
+{
+    static std::string of(const Sale& sale, size_t position);
+};
+
 class FileManager 
 {
 private:
     Logger* logger;
 
+    template<typename T>
+    static T decodeRecord(const std::string& bytes) 
+    {
+        BinaryReader in(bytes.data(), bytes.data() + bytes.size());
+        T item;
+        RecordFormat<T>::read(in, item, RecordFormat<T>::revision());
+        return item;
+    }
+
+    //          ,     
+    template<typename T>
+    static void applyOverlay(const Checkpoint::Overlay& overlay, std::vector<T>& data) 
+    {
+        const auto& changes = overlay.getChanges();
+        std::vector<bool> applied(changes.size(), false);
+        std::vector<T> merged;
+        merged.reserve(data.size() + changes.size());
+        for (size_t i = 0; i < data.size(); ++i) 
+        {
+            const Checkpoint::Change* change = overlay.find(RecordKey<T>::of(data[i], i));
+            if (!change) 
+            {
+                merged.push_back(std::move(data[i]));
+                continue;
+            }
+            applied[overlay.indexOf(change)] = true;
+            if (!change->removed) 
+            {
+                merged.push_back(decodeRecord<T>(change->record));
+            }
+        }
+        for (size_t i = 0; i < changes.size(); ++i) 
+        {
+            if (!applied[i] && !changes[i].removed) 
+            {
+                merged.push_back(decodeRecord<T>(changes[i].record));
+            }
+        }
+        data.swap(merged);
+    }
+
 public:
     FileManager();
 
@@ -27,24 +122,41 @@ public:
     {
         try 
         {
-            std::ofstream file(filename, std::ios::binary);
-            if (!file.is_open()) 
+            if (!StringDictionary::getInstance()->flush()) 
             {
-                throw FileIOException("Cannot open file for writing: " + filename);
+                throw FileIOException("string dictionary is not saved");
             }
 
-            size_t size = data.size();
-            file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+            Checkpoint* checkpoint = Checkpoint::getInstance();
+            if (checkpoint->isTracked(filename)) 
+            {
+                if (checkpoint->isEnabled()) 
+                {
+                    size_t changes = checkpoint->commit(filename, encodeRecords(data));
+                    if (logger) 
+                    {
+                        logger->log(LogLevel::INFO, "Changes logged for " + filename + ", records: " + std::to_string(changes));
+                    }
+                    return true;
+                }
+                // ,  ,      ,   
+                if (!checkpoint->compactAll()) 
+                {
+                    throw FileIOException("checkpoint log is not compacted");
+                }
+            }
 
+            DataFileWriter writer(filename, RecordFormat<T>::revision());
             for (const auto& item : data) 
             {
-                item.serialize(file);
+                RecordFormat<T>::write(writer.record(), item);
+                writer.endRecord();
             }
+            writer.commit();
 
-            file.close();
             if (logger) 
             {
-                logger->log(LogLevel::INFO, "Data saved to " + filename + ", items: " + std::to_string(size));
+                logger->log(LogLevel::INFO, "Data saved to " + filename + ", items: " + std::to_string(data.size()));
             }
             return true;
         }
@@ -58,35 +170,69 @@ public:
         }
     }
 
+    //        ;    
     template<typename T>
-    std::vector<T> loadFromFile(const std::string& filename)
+    std::vector<T> readRecords(const std::string& filename) 
     {
+        //     : ,    ,
+        //    ,         
+        auto overlay = Checkpoint::getInstance()->getOverlay(filename);
         std::vector<T> data;
-        try 
+        DataFileReader reader(filename);
+        if (reader.exists()) 
         {
-            std::ifstream file(filename, std::ios::binary);
-            if (!file.is_open()) 
+            uint16_t revision = reader.getSchemaRevision();
+            if (revision > RecordFormat<T>::revision()) 
             {
-                return data;
+                throw FileIOException("Schema revision " + std::to_string(revision) + " is newer than supported");
             }
 
-            size_t size;
-            file.read(reinterpret_cast<char*>(&size), sizeof(size));
-
+            size_t size = reader.getRecordCount();
             data.resize(size);
             for (size_t i = 0; i < size; ++i) 
             {
-                data[i].deserialize(file);
+                RecordFormat<T>::read(reader.nextRecord(), data[i], revision);
             }
+            reader.finish();
+        }
+
+        if (overlay) 
+        {
+            applyOverlay(*overlay, data);
+        }
+        return data;
+    }
+
+    template<typename T>
+    std::vector<Checkpoint::Record> encodeRecords(const std::vector<T>& data) 
+    {
+        std::vector<Checkpoint::Record> records;
+        records.reserve(data.size());
+        BinaryWriter record;
+        for (size_t i = 0; i < data.size(); ++i) 
+        {
+            record.clear();
+            RecordFormat<T>::write(record, data[i]);
+            records.push_back(Checkpoint::Record{ RecordKey<T>::of(data[i], i), std::string(record.data(), record.size()) });
+        }
+        return records;
+    }
 
-            file.close();
+    template<typename T>
+    std::vector<T> loadFromFile(const std::string& filename)
+    {
+        std::vector<T> data;
+        try 
+        {
+            data = readRecords<T>(filename);
             if (logger) 
             {
-                logger->log(LogLevel::INFO, "Data loaded from " + filename + ", items: " + std::to_string(size));
+                logger->log(LogLevel::INFO, "Data loaded from " + filename + ", items: " + std::to_string(data.size()));
             }
         }
         catch (const std::exception& e)
         {
+            data.clear();
             if (logger)
             {
                 logger->log(LogLevel::ERR, "Failed to load data from " + filename + ": " + e.what());
@@ -96,32 +242,66 @@ public:
     }
 
     template<typename T>
-    bool appendToFile(const std::string& filename, const T& item) 
+    bool appendToFile(const std::string& filename, const T& item, bool sync = false) 
+    {
+        return appendToFile(filename, std::vector<T>{ item }, sync);
+    }
+
+    template<typename T>
+    bool appendToFile(const std::string& filename, const std::vector<T>& items, bool sync = false) 
     {
+        try 
+        {
+            if (!StringDictionary::getInstance()->flush()) 
+            {
+                throw FileIOException("string dictionary is not saved");
+            }
+
+            //        :      saveToFile
+            if (!Checkpoint::getInstance()->isTracked(filename)) 
+            {
+                DataFileAppender appender(filename, RecordFormat<T>::revision());
+                for (const auto& item : items) 
+                {
+                    RecordFormat<T>::write(appender.record(), item);
+                    appender.endRecord();
+                }
+                if (appender.commit(sync)) 
+                {
+                    if (logger) 
+                    {
+                        logger->log(LogLevel::INFO, "Data appended to " + filename + ", items: " + std::to_string(items.size()));
+                    }
+                    return true;
+                }
+            }
+        }
+        catch (const std::exception& e) 
+        {
+            if (logger) 
+            {
+                logger->log(LogLevel::ERR, "Failed to append data to " + filename + ": " + e.what());
+            }
+            return false;
+        }
+
         auto data = loadFromFile<T>(filename);
-        data.push_back(item);
+        data.insert(data.end(), items.begin(), items.end());
         return saveToFile(filename, data);
     }
 
+    static void setGroupCommit(bool enabled);
+    static bool flushPendingWrites();
+    static void setCheckpointing(bool enabled);
+
     std::vector<std::string> loadStringList(const std::string& filename);
     bool saveStringList(const std::string& filename, const std::vector<std::string>& list);
-    bool appendToStringList(const std::string& filename, const std::string& item);
+    bool appendToStringList(const std::string& filename, const std::string& item, bool sync = false);
+    bool appendToStringList(const std::string& filename, const std::vector<std::string>& items, bool sync = false);
 };
 
 template<>
 bool FileManager::saveToFile<std::string>(const std::string& filename, const std::vector<std::string>& data);
 
 template<>
-std::vector<std::string> FileManager::loadFromFile<std::string>(const std::string& filename);
-
-template<>
-bool FileManager::saveToFile<std::shared_ptr<User>>(const std::string& filename, const std::vector<std::shared_ptr<User>>& data);
-
-template<>
-std::vector<std::shared_ptr<User>> FileManager::loadFromFile<std::shared_ptr<User>>(const std::string& filename);
-
-template<>
-bool FileManager::saveToFile<std::shared_ptr<Product>>(const std::string& filename, const std::vector<std::shared_ptr<Product>>& data);
-
-template<>
-std::vector<std::shared_ptr<Product>> FileManager::loadFromFile<std::shared_ptr<Product>>(const std::string& filename);
\ No newline at end of file
+std::vector<std::string> FileManager::loadFromFile<std::string>(const std::string& filename);
\ No newline at end of file
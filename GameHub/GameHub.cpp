@@ -11,24 +11,27 @@
 #include "Menu.h"
 #include "Logger.h"
 #include "FileManager.h"
+#include "IdSequence.h"
 #include "InputValidation.h"
 #include "User.h"
+#include "StartupLoader.h"
 
 // Функция для создания первого администратора при первом запуске
-void createFirstAdmin() 
+void createFirstAdmin(std::vector<std::shared_ptr<User>>& users) 
 {
     FileManager fileManager;
-    auto users = fileManager.loadFromFile<std::shared_ptr<User>>(Config::USERS_FILE);
 
     bool hasAdmin = false;
+    int maxUserId = 0;
     for (const auto& user : users) 
     {
         if (user->getRole() == "admin") 
         {
             hasAdmin = true;
-            break;
         }
+        maxUserId = (std::max)(maxUserId, user->getId());
     }
+    IdSequence::getInstance()->observe("users", maxUserId);
 
     if (!hasAdmin)
     {
@@ -51,7 +54,7 @@ void createFirstAdmin()
             std::cout << "Пароли не совпадают! Повторите попытку." << std::endl;
             TableFormatter::pause();
             TableFormatter::clearScreen();
-            createFirstAdmin(); 
+            createFirstAdmin(users); 
             return;
         }
 
@@ -59,7 +62,7 @@ void createFirstAdmin()
         std::string hashedPassword = InputValidation::hashPassword(password, salt);
         std::string storedPassword = salt + ":" + hashedPassword; 
 
-        int adminId = 1;
+        int adminId = IdSequence::getInstance()->next("users");
         auto admin = std::make_shared<Admin>(adminId, username, storedPassword, email, phone);
 
         users.push_back(admin);
@@ -85,12 +88,17 @@ int main()
         Logger* logger = Logger::getInstance();
         logger->log(LogLevel::INFO, "Запуск системы GameHub");
 
-        createFirstAdmin();
+        // Пользователи читаются один раз вместе с остальными файлами и передаются в проверку администратора
+        StartupLoader startupLoader;
+        StartupData startupData = startupLoader.load();
+        createFirstAdmin(startupData.users);
 
         FileManager fileManager;
+        FileManager::setGroupCommit(true);
+        FileManager::setCheckpointing(true);
 
-        Store store;
-        Wishlist wishlist(fileManager);  
+        Store store(std::move(startupData.store));
+        Wishlist wishlist(fileManager, std::move(startupData.wishlistItems));  
         RecommendationSystem recommendationSystem(store);
         Report report(store);
         NotificationSystem notificationSystem;
@@ -98,10 +106,14 @@ int main()
         MainMenu mainMenu(store, wishlist, recommendationSystem, report, notificationSystem);
         mainMenu.show();
 
+        IdSequence::getInstance()->flush();
+        FileManager::setCheckpointing(false);
+        FileManager::setGroupCommit(false);
         logger->log(LogLevel::INFO, "Завершение работы системы GameHub");
     }
     catch (const std::exception& e) 
     {
+        FileManager::flushPendingWrites();
         std::cerr << "Критическая ошибка: " << e.what() << std::endl;
         Config::setColor(Config::COLOR_ERROR);
         std::cerr << "Система будет завершена." << std::endl;
@@ -110,6 +122,7 @@ int main()
     }
     catch (...) 
     {
+        FileManager::flushPendingWrites();
         std::cerr << "Неизвестная критическая ошибка!" << std::endl;
         Config::setColor(Config::COLOR_ERROR);
         std::cerr << "Система будет завершена." << std::endl;
@@ -0,0 +1,108 @@
+#include "HotProductTable.h"
+
+const uint64_t HotProductTable::TAG_OVERFLOW;
+const size_t HotProductTable::TAG_BITS;
+
+HotProductTable::HotProductTable() : tagVersion(0) {}
+
+void HotProductTable::clear() 
+{
+    rows.clear();
+    tagBits.clear();
+    tagVersion++;
+}
+
+void HotProductTable::reserve(size_t count) 
+{
+    rows.reserve(count);
+}
+
+HotProduct HotProductTable::makeRow(const Product& product) 
+{
+    HotProduct row = describe(product);
+    row.tagMask = 0;
+    for (StringId tag : product.getTagIds()) 
+    {
+        auto it = tagBits.find(tag);
+        if (it == tagBits.end() && tagBits.size() < TAG_BITS) 
+        {
+            it = tagBits.emplace(tag, 1ull << tagBits.size()).first;
+            tagVersion++;
+        }
+        row.tagMask |= it != tagBits.end() ? it->second : TAG_OVERFLOW;
+    }
+    return row;
+}
+
+HotProduct HotProductTable::describe(const Product& product) const 
+{
+    HotProduct row;
+    row.id = product.getId();
+    row.activationKeys = product.getActivationKeys();
+    row.basePrice = product.getBasePrice();
+    row.averageRating = product.getAverageRating();
+    row.genreId = product.getGenreId();
+    row.developerId = product.getDeveloperId();
+    row.tagMask = findTags(product.getTagIds());
+    return row;
+}
+
+void HotProductTable::append(const Product& product) 
+{
+    rows.push_back(makeRow(product));
+}
+
+void HotProductTable::assign(size_t slot, const Product& product) 
+{
+    if (slot < rows.size()) 
+    {
+        rows[slot] = makeRow(product);
+    }
+}
+
+void HotProductTable::erase(size_t slot) 
+{
+    if (slot < rows.size()) 
+    {
+        rows.erase(rows.begin() + slot);
+    }
+}
+
+void HotProductTable::updateStock(size_t slot, const Product& product) 
+{
+    if (slot < rows.size()) 
+    {
+        rows[slot].activationKeys = product.getActivationKeys();
+    }
+}
+
+uint64_t HotProductTable::findTags(const std::vector<StringId>& tags) const 
+{
+    uint64_t mask = 0;
+    for (StringId tag : tags) 
+    {
+        auto it = tagBits.find(tag);
+        mask |= it != tagBits.end() ? it->second : TAG_OVERFLOW;
+    }
+    return mask;
+}
+
+unsigned long HotProductTable::getTagVersion() const 
+{
+    return tagVersion;
+}
+
+size_t HotProductTable::size() const 
+{
+    return rows.size();
+}
+
+const HotProduct& HotProductTable::operator[](size_t slot) const 
+{
+    return rows[slot];
+}
+
+const std::vector<HotProduct>& HotProductTable::getRows() const 
+{
+    return rows;
+}
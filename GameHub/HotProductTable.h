@@ -0,0 +1,56 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include "Product.h"
+
+//      : , , .
+//       ,  -  .
+struct HotProduct 
+{
+    int id;
+    int activationKeys;
+    double basePrice;
+    double averageRating;
+    StringId genreId;
+    StringId developerId;
+    uint64_t tagMask;
+};
+
+//   ,        Store.
+//          ,    .
+class HotProductTable 
+{
+public:
+    //            
+    static const uint64_t TAG_OVERFLOW = 1ull << 63;
+    static const size_t TAG_BITS = 63;
+
+private:
+    std::vector<HotProduct> rows;
+    std::unordered_map<StringId, uint64_t> tagBits;
+    unsigned long tagVersion;
+
+    HotProduct makeRow(const Product& product);
+
+public:
+    HotProductTable();
+
+    void clear();
+    void reserve(size_t count);
+    void append(const Product& product);
+    void assign(size_t slot, const Product& product);
+    void erase(size_t slot);
+    void updateStock(size_t slot, const Product& product);
+
+    //     :     
+    HotProduct describe(const Product& product) const;
+
+    uint64_t findTags(const std::vector<StringId>& tags) const;
+    unsigned long getTagVersion() const;
+
+    size_t size() const;
+    const HotProduct& operator[](size_t slot) const;
+    const std::vector<HotProduct>& getRows() const;
+};
@@ -0,0 +1,99 @@
+#include "IdSequence.h"
+#include "FileManager.h"
+
+IdSequence* IdSequence::instance = nullptr;
+std::mutex IdSequence::mtx;
+
+IdSequence::IdSequence() 
+{
+    logger = Logger::getInstance();
+
+    FileManager fileManager;
+    auto entries = fileManager.loadFromFile<Entry>(Config::SEQUENCES_FILE);
+    for (const auto& entry : entries) 
+    {
+        //       ,     
+        sequences[entry.entity] = { entry.reservedUpTo, entry.reservedUpTo };
+    }
+}
+
+IdSequence* IdSequence::getInstance() 
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    if (instance == nullptr) 
+    {
+        instance = new IdSequence();
+    }
+    return instance;
+}
+
+void IdSequence::persist() 
+{
+    std::vector<Entry> entries;
+    entries.reserve(sequences.size());
+    for (const auto& sequence : sequences) 
+    {
+        entries.emplace_back(sequence.first, sequence.second.reservedUpTo);
+    }
+
+    FileManager fileManager;
+    if (!fileManager.saveToFile(Config::SEQUENCES_FILE, entries)) 
+    {
+        throw FileIOException("Cannot persist id sequences: " + Config::SEQUENCES_FILE);
+    }
+    //         ,    
+    if (!FileManager::flushPendingWrites()) 
+    {
+        throw FileIOException("Cannot persist id sequences: " + Config::SEQUENCES_FILE);
+    }
+}
+
+int IdSequence::next(const std::string& entity) 
+{
+    std::lock_guard<std::mutex> lock(mtx);
+
+    auto it = sequences.find(entity);
+    if (it == sequences.end()) 
+    {
+        it = sequences.insert({ entity, { 1, 1 } }).first;
+    }
+
+    State& state = it->second;
+    if (state.nextId >= state.reservedUpTo) 
+    {
+        state.reservedUpTo = state.nextId + Config::ID_BLOCK_SIZE;
+        persist();
+    }
+    return state.nextId++;
+}
+
+void IdSequence::observe(const std::string& entity, int existingId) 
+{
+    std::lock_guard<std::mutex> lock(mtx);
+
+    auto it = sequences.find(entity);
+    if (it == sequences.end()) 
+    {
+        it = sequences.insert({ entity, { 1, 1 } }).first;
+    }
+
+    State& state = it->second;
+    if (existingId >= state.nextId) 
+    {
+        logger->log(LogLevel::INFO, "Id sequence '" + entity + "' recovered from data: next id " + std::to_string(existingId + 1));
+        state.nextId = existingId + 1;
+        state.reservedUpTo = (std::max)(state.reservedUpTo, state.nextId);
+    }
+}
+
+void IdSequence::flush() 
+{
+    std::lock_guard<std::mutex> lock(mtx);
+
+    //      ,     
+    for (auto& sequence : sequences) 
+    {
+        sequence.second.reservedUpTo = sequence.second.nextId;
+    }
+    persist();
+}
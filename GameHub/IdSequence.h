@@ -0,0 +1,56 @@
+#pragma once
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include "Config.h"
+#include "Logger.h"
+#include "Schema.h"
+
+//      (products, sales, users).
+//      ,    
+//          .
+class IdSequence 
+{
+public:
+    struct Entry 
+    {
+        std::string entity;
+        int reservedUpTo;
+
+        Entry() : reservedUpTo(1) {}
+        Entry(const std::string& name, int reserved) : entity(name), reservedUpTo(reserved) {}
+
+        static auto fields() 
+        {
+            return std::make_tuple(Schema::field(&Entry::entity), Schema::field(&Entry::reservedUpTo));
+        }
+    };
+
+private:
+    struct State 
+    {
+        int nextId;
+        int reservedUpTo;
+    };
+
+    static IdSequence* instance;
+    static std::mutex mtx;
+
+    std::map<std::string, State> sequences;
+    Logger* logger;
+
+    IdSequence();
+    void persist();
+
+public:
+    static IdSequence* getInstance();
+
+    int next(const std::string& entity);
+    void observe(const std::string& entity, int existingId);
+    void flush();
+
+    IdSequence(const IdSequence&) = delete;
+    IdSequence& operator=(const IdSequence&) = delete;
+};
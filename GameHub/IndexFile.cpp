@@ -0,0 +1,133 @@
+#include "IndexFile.h"
+#include "DataFile.h"
+#include "MappedFile.h"
+#include "CommitQueue.h"
+#include "Checkpoint.h"
+
+bool IndexStamp::operator==(const IndexStamp& other) const 
+{
+    return formatVersion == other.formatVersion && schemaRevision == other.schemaRevision &&
+        fileSize == other.fileSize && fileCrc == other.fileCrc && overlayCrc == other.overlayCrc;
+}
+
+bool IndexStamp::operator!=(const IndexStamp& other) const 
+{
+    return !(*this == other);
+}
+
+IndexStamp IndexFile::stampOf(const std::string& dataFile) 
+{
+    IndexStamp stamp;
+
+    //     ,     
+    auto overlay = Checkpoint::getInstance()->getOverlay(dataFile);
+    if (overlay) 
+    {
+        std::string changes;
+        for (const auto& change : overlay->getChanges()) 
+        {
+            DataFormat::putU64(changes, change.key.size());
+            changes += change.key;
+            changes += change.removed ? '\1' : '\0';
+            DataFormat::putU64(changes, change.record.size());
+            changes += change.record;
+        }
+        stamp.overlayCrc = DataFormat::crc32(changes.data(), changes.size());
+    }
+
+    CommitQueue::getInstance()->flush(dataFile);
+    MappedFile mapped;
+    if (!mapped.open(dataFile)) 
+    {
+        return stamp;
+    }
+
+    const char* data = mapped.data();
+    stamp.fileSize = mapped.size();
+    stamp.fileCrc = DataFormat::crc32(data, mapped.size());
+    if (mapped.size() >= 8 && DataFormat::getU32(data) == DataFormat::MAGIC) 
+    {
+        stamp.formatVersion = DataFormat::getU16(data + 4);
+        stamp.schemaRevision = DataFormat::getU16(data + 6);
+    }
+    return stamp;
+}
+
+bool IndexFile::load(const std::string& filename, const IndexStamp& stamp, ProductIndex& productIndex, SearchIndex& searchIndex) 
+{
+    MappedFile mapped;
+    if (!mapped.open(filename)) 
+    {
+        return false;
+    }
+
+    const char* data = mapped.data();
+    if (mapped.size() < HEADER_SIZE || DataFormat::getU32(data) != MAGIC || DataFormat::getU16(data + 4) != VERSION) 
+    {
+        return false;
+    }
+
+    IndexStamp saved;
+    saved.formatVersion = DataFormat::getU16(data + 6);
+    saved.schemaRevision = DataFormat::getU16(data + 8);
+    saved.fileSize = DataFormat::getU64(data + 10);
+    saved.fileCrc = DataFormat::getU32(data + 18);
+    saved.overlayCrc = DataFormat::getU32(data + 22);
+    uint64_t payloadSize = DataFormat::getU64(data + 26);
+    uint32_t payloadCrc = DataFormat::getU32(data + 34);
+    if (saved != stamp || payloadSize != mapped.size() - HEADER_SIZE) 
+    {
+        return false;
+    }
+
+    const char* payload = data + HEADER_SIZE;
+    if (DataFormat::crc32(payload, static_cast<size_t>(payloadSize)) != payloadCrc) 
+    {
+        Logger::getInstance()->log(LogLevel::WARNING, "Index file checksum mismatch: " + filename);
+        return false;
+    }
+
+    try 
+    {
+        BinaryReader reader(payload, payload + payloadSize);
+        productIndex.read(reader);
+        searchIndex.read(reader);
+        if (reader.remaining() != 0) 
+        {
+            throw FileIOException("unexpected data after indexes");
+        }
+    }
+    catch (const FileIOException& e) 
+    {
+        Logger::getInstance()->log(LogLevel::WARNING, "Index file " + filename + " is damaged: " + e.what());
+        productIndex.clear();
+        searchIndex.clear();
+        return false;
+    }
+    return true;
+}
+
+void IndexFile::save(const std::string& filename, const IndexStamp& stamp, const BinaryWriter& productIndex, const SearchIndex& searchIndex) 
+{
+    BinaryWriter writer;
+    writer.writeBytes(productIndex.data(), productIndex.size());
+    searchIndex.write(writer);
+
+    std::string contents;
+    contents.reserve(HEADER_SIZE + writer.size());
+    DataFormat::putU32(contents, MAGIC);
+    DataFormat::putU16(contents, VERSION);
+    DataFormat::putU16(contents, stamp.formatVersion);
+    DataFormat::putU16(contents, stamp.schemaRevision);
+    DataFormat::putU64(contents, stamp.fileSize);
+    DataFormat::putU32(contents, stamp.fileCrc);
+    DataFormat::putU32(contents, stamp.overlayCrc);
+    DataFormat::putU64(contents, writer.size());
+    DataFormat::putU32(contents, DataFormat::crc32(writer.data(), writer.size()));
+    contents.append(writer.data(), writer.size());
+
+    if (!CommitQueue::getInstance()->submit(filename, contents)) 
+    {
+        DataFormat::replaceFile(filename, contents);
+    }
+}
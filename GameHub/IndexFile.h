@@ -0,0 +1,44 @@
+#pragma once
+#include <string>
+#include <cstdint>
+#include "Config.h"
+#include "Logger.h"
+#include "ProductIndex.h"
+#include "SearchIndex.h"
+
+//   :  ,  ,   CRC ,   CRC
+//     ,     
+struct IndexStamp 
+{
+    uint16_t formatVersion;
+    uint16_t schemaRevision;
+    uint64_t fileSize;
+    uint32_t fileCrc;
+    uint32_t overlayCrc;
+
+    IndexStamp() : formatVersion(0), schemaRevision(0), fileSize(0), fileCrc(0), overlayCrc(0) {}
+
+    bool operator==(const IndexStamp& other) const;
+    bool operator!=(const IndexStamp& other) const;
+};
+
+//        .  ,  
+//        ,    .
+// : , , ,   CRC ,   .
+class IndexFile 
+{
+private:
+    static const uint32_t MAGIC = 0x58494847;
+    static const uint16_t VERSION = 1;
+    static const size_t HEADER_SIZE = 38;
+
+public:
+    static IndexStamp stampOf(const std::string& dataFile);
+
+    // false,   ,         
+    static bool load(const std::string& filename, const IndexStamp& stamp, ProductIndex& productIndex, SearchIndex& searchIndex);
+
+    //     (ProductIndex::write):   
+    //  ,   .      ,   
+    static void save(const std::string& filename, const IndexStamp& stamp, const BinaryWriter& productIndex, const SearchIndex& searchIndex);
+};
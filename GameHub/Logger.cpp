@@ -3,6 +3,11 @@
 Logger* Logger::instance = nullptr;
 std::mutex Logger::mtx;
 
+namespace 
+{
+    thread_local bool consoleOutput = true;
+}
+
 Logger::Logger() 
 {
     logFile.open(Config::LOG_FILE, std::ios::app);
@@ -54,9 +59,17 @@ void Logger::log(LogLevel level, const std::string& message)
     logFile << logEntry << std::endl;
     logFile.flush();
 
-    Config::setColor(color);
-    std::cout << logEntry << std::endl;
-    Config::resetColor();
+    if (consoleOutput) 
+    {
+        Config::setColor(color);
+        std::cout << logEntry << std::endl;
+        Config::resetColor();
+    }
+}
+
+void Logger::setConsoleOutput(bool enabled) 
+{
+    consoleOutput = enabled;
 }
 
 Logger::~Logger() 
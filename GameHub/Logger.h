@@ -22,6 +22,8 @@ private:
 public:
     static Logger* getInstance();
     void log(LogLevel level, const std::string& message);
+    //      .      ,    
+    void setConsoleOutput(bool enabled);
     ~Logger();
 
     Logger(const Logger&) = delete;
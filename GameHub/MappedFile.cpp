@@ -0,0 +1,72 @@
+#include "MappedFile.h"
+#include "Exceptions.h"
+
+MappedFile::MappedFile() : file(INVALID_HANDLE_VALUE), mapping(nullptr), view(nullptr), length(0) {}
+
+MappedFile::~MappedFile() 
+{
+    close();
+}
+
+bool MappedFile::open(const std::string& filename) 
+{
+    close();
+
+    file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) 
+    {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) 
+    {
+        close();
+        throw FileIOException("Cannot determine size of file: " + filename);
+    }
+
+    length = static_cast<size_t>(fileSize.QuadPart);
+    if (length == 0) 
+    {
+        return true;
+    }
+
+    mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) 
+    {
+        close();
+        throw FileIOException("Cannot map file: " + filename);
+    }
+
+    view = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!view) 
+    {
+        close();
+        throw FileIOException("Cannot map view of file: " + filename);
+    }
+    return true;
+}
+
+void MappedFile::close() 
+{
+    if (view) 
+    {
+        UnmapViewOfFile(view);
+        view = nullptr;
+    }
+    if (mapping) 
+    {
+        CloseHandle(mapping);
+        mapping = nullptr;
+    }
+    if (file != INVALID_HANDLE_VALUE) 
+    {
+        CloseHandle(file);
+        file = INVALID_HANDLE_VALUE;
+    }
+    length = 0;
+}
+
+const char* MappedFile::data() const { return view; }
+size_t MappedFile::size() const { return length; }
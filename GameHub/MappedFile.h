@@ -0,0 +1,27 @@
+#pragma once
+#include <string>
+#include <windows.h>
+
+//       .    
+//        .
+class MappedFile 
+{
+private:
+    HANDLE file;
+    HANDLE mapping;
+    const char* view;
+    size_t length;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+public:
+    MappedFile();
+    ~MappedFile();
+
+    bool open(const std::string& filename);
+    void close();
+
+    const char* data() const;
+    size_t size() const;
+};
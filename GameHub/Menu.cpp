@@ -64,8 +64,6 @@ void MainMenu::aboutSystem()
 
     FileManager fileManager;
     auto users = fileManager.loadFromFile<std::shared_ptr<User>>(Config::USERS_FILE);
-    auto products = fileManager.loadFromFile<std::shared_ptr<Product>>(Config::PRODUCTS_FILE);
-    auto sales = fileManager.loadFromFile<Sale>(Config::SALES_FILE);
 
     Config::setColor(Config::COLOR_HEADER);
     std::cout << " :" << std::endl;
@@ -94,8 +92,8 @@ void MainMenu::aboutSystem()
 
     std::cout << " - : " << adminCount << std::endl;
     std::cout << " - : " << customerCount << " (: " << approvedCustomers << ")" << std::endl;
-    std::cout << "  : " << products.size() << std::endl;
-    std::cout << " : " << sales.size() << std::endl;
+    std::cout << "  : " << store.getProductsSnapshot().size() << std::endl;
+    std::cout << " : " << store.getSaleCount() << std::endl;
     std::cout << std::endl;
 
     Config::setColor(Config::COLOR_SUCCESS);
@@ -168,7 +166,7 @@ bool MainMenu::login()
         {
             if (user->isBlocked()) 
             {
-                TableFormatter::displayErrorMessage("  : " + user->getUnlockDate());
+                TableFormatter::displayErrorMessage("  : " + user->getUnlockDate().toString());
                 TableFormatter::pause();
                 return false;
             }
@@ -255,17 +253,7 @@ void MainMenu::registerUser()
         return;
     }
 
-    int newId = 1;
-    if (!users.empty()) 
-    {
-        for (const auto& user : users) 
-        {
-            if (user->getId() >= newId) 
-            {
-                newId = user->getId() + 1;
-            }
-        }
-    }
+    int newId = IdSequence::getInstance()->next("users");
 
     std::string salt = InputValidation::generateSalt();
     std::string hashedPassword = InputValidation::hashPassword(password, salt);
@@ -850,19 +838,12 @@ void AdminMenu::blockUser(const std::vector<std::shared_ptr<User>>& users, FileM
                 return;
             }
 
-            auto now = std::chrono::system_clock::now();
-            auto unlockTime = now + std::chrono::hours(24 * days);
-            std::time_t unlockTime_t = std::chrono::system_clock::to_time_t(unlockTime);
-            std::tm tm;
-            localtime_s(&tm, &unlockTime_t);
-
-            char buffer[80];
-            std::strftime(buffer, sizeof(buffer), Config::DATE_FORMAT.c_str(), &tm);
-            user->setUnlockDate(buffer);
+            Timestamp unlockDate(Timestamp::now().getSeconds() + static_cast<int64_t>(days) * 24 * 60 * 60);
+            user->setUnlockDate(unlockDate);
 
             if (fileManager.saveToFile(Config::USERS_FILE, users)) 
             {
-                TableFormatter::displaySuccessMessage("  : " + std::string(buffer));
+                TableFormatter::displaySuccessMessage("  : " + unlockDate.toString());
                 TableFormatter::pause();
                 logger->log(LogLevel::INFO, "User blocked: " + user->getUsername());
             }
@@ -895,7 +876,7 @@ void AdminMenu::unblockUser(const std::vector<std::shared_ptr<User>>& users, Fil
                 return;
             }
 
-            user->setUnlockDate("");
+            user->setUnlockDate(Timestamp());
 
             if (fileManager.saveToFile(Config::USERS_FILE, users)) 
             {
@@ -1393,8 +1374,7 @@ void AdminMenu::addNewGenre()
     }
     else 
     {
-        genres.push_back(newGenre);
-        if (fileManager.saveStringList(Config::GENRES_FILE, genres)) 
+        if (fileManager.appendToStringList(Config::GENRES_FILE, newGenre)) 
         {
             TableFormatter::displaySuccessMessage("  !");
         }
@@ -1495,8 +1475,7 @@ void AdminMenu::addNewTag()
     }
     else 
     {
-        tags.push_back(newTag);
-        if (fileManager.saveStringList(Config::TAGS_FILE, tags)) 
+        if (fileManager.appendToStringList(Config::TAGS_FILE, newTag)) 
         {
             TableFormatter::displaySuccessMessage("  !");
         }
@@ -1901,8 +1880,8 @@ void AdminMenu::addNewDiscount()
 
     double percentage = InputValidation::getValidatedDouble("   (1-100): ", 1.0, 100.0);
 
-    std::string startDate = InputValidation::getValidatedDate("    (.. ::): ");
-    std::string endDate = InputValidation::getValidatedDate("    (.. ::): ");
+    Timestamp startDate = Timestamp::parse(InputValidation::getValidatedDate("    (.. ::): "));
+    Timestamp endDate = Timestamp::parse(InputValidation::getValidatedDate("    (.. ::): "));
 
     if (startDate >= endDate) {
         TableFormatter::displayErrorMessage("      !");
@@ -1912,7 +1891,7 @@ void AdminMenu::addNewDiscount()
 
     Discount newDiscount;
     newDiscount.type = discountType;
-    newDiscount.targets = targets;
+    newDiscount.targets = StringDictionary::getInstance()->internAll(targets);
     newDiscount.percentage = percentage;
     newDiscount.startDate = startDate;
     newDiscount.endDate = endDate;
@@ -1927,7 +1906,7 @@ void AdminMenu::addNewDiscount()
     }
     std::cout << std::endl;
     std::cout << ": " << percentage << "%" << std::endl;
-    std::cout << ": " << startDate << " - " << endDate << std::endl;
+    std::cout << ": " << startDate.toString() << " - " << endDate.toString() << std::endl;
 
     if (confirmAction("  ?")) 
     {
@@ -2141,15 +2120,16 @@ void AdminMenu::editDiscount()
     TableFormatter::displaySuccessMessage("  :");
     std::cout << ": " << discount.type << std::endl;
     std::cout << ": ";
-    for (size_t i = 0; i < discount.targets.size(); ++i) 
+    auto targetNames = discount.getTargetNames();
+    for (size_t i = 0; i < targetNames.size(); ++i) 
     {
-        std::cout << discount.targets[i];
-        if (i < discount.targets.size() - 1) std::cout << ", ";
+        std::cout << targetNames[i];
+        if (i < targetNames.size() - 1) std::cout << ", ";
     }
     std::cout << std::endl;
     std::cout << ": " << discount.percentage << "%" << std::endl;
-    std::cout << ": " << discount.startDate << std::endl;
-    std::cout << ": " << discount.endDate << std::endl;
+    std::cout << ": " << discount.startDate.toString() << std::endl;
+    std::cout << ": " << discount.endDate.toString() << std::endl;
     std::cout << std::endl;
 
     if (!confirmAction(" ,     ?")) 
@@ -2165,16 +2145,16 @@ void AdminMenu::editDiscount()
         discount.percentage = newPercentage;
     }
 
-    std::string newStartDate = InputValidation::getValidatedDate("   (: " + discount.startDate + ",    ): ");
+    std::string newStartDate = InputValidation::getValidatedDate("   (: " + discount.startDate.toString() + ",    ): ");
     if (!newStartDate.empty()) 
     {
-        discount.startDate = newStartDate;
+        discount.startDate = Timestamp::parse(newStartDate);
     }
 
-    std::string newEndDate = InputValidation::getValidatedDate("   (: " + discount.endDate + ",    ): ");
+    std::string newEndDate = InputValidation::getValidatedDate("   (: " + discount.endDate.toString() + ",    ): ");
     if (!newEndDate.empty()) 
     {
-        discount.endDate = newEndDate;
+        discount.endDate = Timestamp::parse(newEndDate);
     }
 
     if (discount.startDate >= discount.endDate) 
@@ -2219,14 +2199,15 @@ void AdminMenu::deleteDiscount()
     TableFormatter::displaySuccessMessage("    :");
     std::cout << ": " << discount.type << std::endl;
     std::cout << ": ";
-    for (size_t i = 0; i < discount.targets.size(); ++i)
+    auto targetNames = discount.getTargetNames();
+    for (size_t i = 0; i < targetNames.size(); ++i)
     {
-        std::cout << discount.targets[i];
-        if (i < discount.targets.size() - 1) std::cout << ", ";
+        std::cout << targetNames[i];
+        if (i < targetNames.size() - 1) std::cout << ", ";
     }
     std::cout << std::endl;
     std::cout << ": " << discount.percentage << "%" << std::endl;
-    std::cout << ": " << discount.startDate << " - " << discount.endDate << std::endl;
+    std::cout << ": " << discount.startDate.toString() << " - " << discount.endDate.toString() << std::endl;
     std::cout << std::endl;
 
     if (!confirmAction(" ,     ?")) 
@@ -2311,8 +2292,8 @@ void AdminMenu::viewReports()
         case 1: 
         {
             displayHeader("  ");
-            std::string startDate = InputValidation::getValidatedDate("   (.. ::): ");
-            std::string endDate = InputValidation::getValidatedDate("   (.. ::): ");
+            Timestamp startDate = Timestamp::parse(InputValidation::getValidatedDate("   (.. ::): "));
+            Timestamp endDate = Timestamp::parse(InputValidation::getValidatedDate("   (.. ::): "));
 
             if (startDate >= endDate) 
             {
@@ -2338,8 +2319,8 @@ void AdminMenu::viewReports()
         case 2:
         {
             displayHeader(" ");
-            std::string startDate = InputValidation::getValidatedDate("   (.. ::): ");
-            std::string endDate = InputValidation::getValidatedDate("   (.. ::): ");
+            Timestamp startDate = Timestamp::parse(InputValidation::getValidatedDate("   (.. ::): "));
+            Timestamp endDate = Timestamp::parse(InputValidation::getValidatedDate("   (.. ::): "));
 
             if (startDate >= endDate) 
             {
@@ -3630,16 +3611,7 @@ void CustomerMenu::viewPurchaseHistory()
     int currentPage = 1;
     const int salesPerPage = 5;
 
-    auto allSales = store.getAllSales();
-    std::vector<Sale> userSales;
-
-    for (const auto& sale : allSales) 
-    {
-        if (sale.getCustomerId() == currentUser->getId()) 
-        {
-            userSales.push_back(sale);
-        }
-    }
+    std::vector<Sale> userSales = store.getCustomerSales(currentUser->getId());
 
     if (userSales.empty())
     {
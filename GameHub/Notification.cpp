@@ -3,12 +3,12 @@
 Notification::Notification(const std::string& msg, const std::string& notifType)
     : message(msg), type(notifType), isRead(false) 
 {
-    timestamp = Config::getCurrentDateTime();
+    timestamp = Timestamp::now();
 }
 
 std::string Notification::getMessage() const { return message; }
 std::string Notification::getType() const { return type; }
-std::string Notification::getTimestamp() const { return timestamp; }
+Timestamp Notification::getTimestamp() const { return timestamp; }
 bool Notification::getIsRead() const { return isRead; }
 
 void Notification::markAsRead() { isRead = true; }
@@ -21,7 +21,7 @@ void Notification::display() const
     else if (type == "success") color = Config::COLOR_SUCCESS;
 
     Config::setColor(color);
-    std::cout << "[" << timestamp << "] " << message;
+    std::cout << "[" << timestamp.toString() << "] " << message;
     if (!isRead) 
     {
         std::cout << " []";
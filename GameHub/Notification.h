@@ -6,13 +6,14 @@
 #include <map>
 #include "Config.h"
 #include "Logger.h"
+#include "Timestamp.h"
 
 class Notification 
 {
 private:
     std::string message;
     std::string type;
-    std::string timestamp;
+    Timestamp timestamp;
     bool isRead;
 
 public:
@@ -20,7 +21,7 @@ public:
 
     std::string getMessage() const;
     std::string getType() const;
-    std::string getTimestamp() const;
+    Timestamp getTimestamp() const;
     bool getIsRead() const;
 
     void markAsRead();
@@ -0,0 +1,172 @@
+#include "PriceEngine.h"
+#include "Store.h"
+
+PriceEngine::PriceEngine() : compiledEpoch(0), compiledTags(0), compiled(false) {}
+
+void PriceEngine::compile(const DiscountScheduler& scheduler, const std::vector<Discount>& discounts, const HotProductTable& table) 
+{
+    activeDiscounts.clear();
+    for (size_t index : scheduler.getActiveDiscounts()) 
+    {
+        if (index >= discounts.size()) 
+        {
+            continue;
+        }
+
+        const Discount& discount = discounts[index];
+        ActiveDiscount active;
+        active.type = discount.type;
+        active.percentage = discount.percentage;
+        active.tagMask = 0;
+        for (StringId target : discount.targets) 
+        {
+            if (discount.type == "product") 
+            {
+                const std::string& text = StringDictionary::getInstance()->text(target);
+                try 
+                {
+                    int productId = std::stoi(text);
+                    if (std::to_string(productId) == text) 
+                    {
+                        active.productIds.insert(productId);
+                    }
+                }
+                catch (const std::exception&) 
+                {
+                }
+            }
+            else if (discount.type == "genre" || discount.type == "developer") 
+            {
+                active.targetIds.insert(target);
+            }
+            else if (discount.type == "tag") 
+            {
+                uint64_t mask = table.findTags({ target });
+                if (mask & HotProductTable::TAG_OVERFLOW) 
+                {
+                    active.unresolved.insert(target);
+                }
+                else 
+                {
+                    active.tagMask |= mask;
+                }
+            }
+        }
+        activeDiscounts.push_back(active);
+    }
+
+    std::fill(cachedSlots.begin(), cachedSlots.end(), false);
+}
+
+double PriceEngine::computeBestDiscount(const HotProduct& row, const Product& product) const 
+{
+    double bestDiscount = 0.0;
+    if (activeDiscounts.empty()) 
+    {
+        return bestDiscount;
+    }
+
+    for (const auto& discount : activeDiscounts) 
+    {
+        bool matches = false;
+        if (discount.type == "product") 
+        {
+            matches = discount.productIds.count(row.id) > 0;
+        }
+        else if (discount.type == "genre") 
+        {
+            matches = discount.targetIds.count(row.genreId) > 0;
+        }
+        else if (discount.type == "developer") 
+        {
+            matches = discount.targetIds.count(row.developerId) > 0;
+        }
+        else if (discount.type == "tag") 
+        {
+            matches = (row.tagMask & discount.tagMask) != 0;
+            if (!matches && (row.tagMask & HotProductTable::TAG_OVERFLOW) && !discount.unresolved.empty()) 
+            {
+                for (StringId tag : product.getTagIds()) 
+                {
+                    if (discount.unresolved.count(tag) > 0) 
+                    {
+                        matches = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (matches) 
+        {
+            bestDiscount = (std::max)(bestDiscount, discount.percentage);
+        }
+    }
+    return bestDiscount;
+}
+
+void PriceEngine::reset(size_t slotCount) 
+{
+    bestDiscounts.assign(slotCount, 0.0);
+    cachedSlots.assign(slotCount, false);
+    compiled = false;
+}
+
+bool PriceEngine::sync(const DiscountScheduler& scheduler, const std::vector<Discount>& discounts, const HotProductTable& table) 
+{
+    //       ,      
+    if (compiled && compiledEpoch == scheduler.getEpoch() && compiledTags == table.getTagVersion()) 
+    {
+        return false;
+    }
+
+    compile(scheduler, discounts, table);
+    compiledEpoch = scheduler.getEpoch();
+    compiledTags = table.getTagVersion();
+    compiled = true;
+    return true;
+}
+
+void PriceEngine::appendSlot() 
+{
+    bestDiscounts.push_back(0.0);
+    cachedSlots.push_back(false);
+}
+
+void PriceEngine::invalidateSlot(size_t slot) 
+{
+    if (slot < cachedSlots.size()) 
+    {
+        cachedSlots[slot] = false;
+    }
+}
+
+void PriceEngine::eraseSlot(size_t slot) 
+{
+    if (slot < cachedSlots.size()) 
+    {
+        bestDiscounts.erase(bestDiscounts.begin() + slot);
+        cachedSlots.erase(cachedSlots.begin() + slot);
+    }
+}
+
+double PriceEngine::getBestDiscount(size_t slot, const HotProduct& row, const Product& product) 
+{
+    if (slot >= cachedSlots.size()) 
+    {
+        bestDiscounts.resize(slot + 1, 0.0);
+        cachedSlots.resize(slot + 1, false);
+    }
+
+    if (!cachedSlots[slot]) 
+    {
+        bestDiscounts[slot] = computeBestDiscount(row, product);
+        cachedSlots[slot] = true;
+    }
+    return bestDiscounts[slot];
+}
+
+double PriceEngine::getBestDiscount(const HotProduct& row, const Product& product) const 
+{
+    return computeBestDiscount(row, product);
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <set>
+#include <unordered_set>
+#include "Product.h"
+#include "HotProductTable.h"
+#include "DiscountScheduler.h"
+
+struct Discount;
+
+//      ,       Store.
+//           .
+//       ,  -    HotProductTable.
+class PriceEngine 
+{
+private:
+    struct ActiveDiscount 
+    {
+        std::string type;
+        std::unordered_set<StringId> targetIds;
+        uint64_t tagMask;
+        std::unordered_set<StringId> unresolved;
+        std::set<int> productIds;
+        double percentage;
+    };
+
+    std::vector<ActiveDiscount> activeDiscounts;
+    unsigned long compiledEpoch;
+    unsigned long compiledTags;
+    bool compiled;
+
+    std::vector<double> bestDiscounts;
+    std::vector<bool> cachedSlots;
+
+    void compile(const DiscountScheduler& scheduler, const std::vector<Discount>& discounts, const HotProductTable& table);
+    double computeBestDiscount(const HotProduct& row, const Product& product) const;
+
+public:
+    PriceEngine();
+
+    void reset(size_t slotCount);
+    bool sync(const DiscountScheduler& scheduler, const std::vector<Discount>& discounts, const HotProductTable& table);
+
+    void appendSlot();
+    void invalidateSlot(size_t slot);
+    void eraseSlot(size_t slot);
+
+    double getBestDiscount(size_t slot, const HotProduct& row, const Product& product);
+    double getBestDiscount(const HotProduct& row, const Product& product) const;
+};
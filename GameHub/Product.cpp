@@ -1,51 +1,139 @@
 #include "Product.h"
+#include "ProductDetailsStore.h"
 
-Product::Product() : id(0), basePrice(0.0), ageRating(0), averageRating(0.0), activationKeys(0) {}
+Product::Product() : id(0), basePrice(0.0), developer(StringDictionary::EMPTY), genre(StringDictionary::EMPTY),
+    ageRating(0), averageRating(0.0), activationKeys(0), lastSaleId(0) {}
 
 Product::Product(int id, const std::string& title, double basePrice, const std::string& developer,
     const std::string& publisher, const std::string& genre, int ageRating,
     const std::string& description, const std::string& releaseDate)
-    : id(id), title(title), basePrice(basePrice), developer(developer),
-    publisher(publisher), genre(genre), ageRating(ageRating),
-    description(description), releaseDate(releaseDate),
-    averageRating(0.0), activationKeys(0) {
+    : id(id), title(title), basePrice(basePrice), developer(StringDictionary::getInstance()->intern(developer)),
+    genre(StringDictionary::getInstance()->intern(genre)), ageRating(ageRating),
+    averageRating(0.0), activationKeys(0), lastSaleId(0), details(std::make_shared<ProductDetails>()) {
+    details->productId = id;
+    details->publisher = StringDictionary::getInstance()->intern(publisher);
+    details->description = description;
+    details->releaseDate = releaseDate;
 }
 
 int Product::getId() const { return id; }
 std::string Product::getTitle() const { return title; }
 double Product::getBasePrice() const { return basePrice; }
-std::string Product::getDeveloper() const { return developer; }
-std::string Product::getPublisher() const { return publisher; }
-std::string Product::getGenre() const { return genre; }
+const std::string& Product::getDeveloper() const { return StringDictionary::getInstance()->text(developer); }
+std::string Product::getPublisher() const { return StringDictionary::getInstance()->text(getDetails()->publisher); }
+const std::string& Product::getGenre() const { return StringDictionary::getInstance()->text(genre); }
+StringId Product::getDeveloperId() const { return developer; }
+StringId Product::getGenreId() const { return genre; }
+const std::vector<StringId>& Product::getTagIds() const { return tags; }
 int Product::getAgeRating() const { return ageRating; }
-std::string Product::getDescription() const { return description; }
-std::string Product::getReleaseDate() const { return releaseDate; }
+std::string Product::getDescription() const { return getDetails()->description; }
+std::string Product::getReleaseDate() const { return getDetails()->releaseDate; }
 double Product::getAverageRating() const { return averageRating; }
-std::vector<std::string> Product::getTags() const { return tags; }
+std::vector<std::string> Product::getTags() const { return StringDictionary::getInstance()->textAll(tags); }
 int Product::getActivationKeys() const { return activationKeys; }
+int Product::getLastSaleId() const { return lastSaleId; }
 
 void Product::setTitle(const std::string& newTitle) { title = newTitle; }
 void Product::setBasePrice(double price) { basePrice = price; }
-void Product::setDeveloper(const std::string& dev) { developer = dev; }
-void Product::setPublisher(const std::string& pub) { publisher = pub; }
-void Product::setGenre(const std::string& newGenre) { genre = newGenre; }
+void Product::setDeveloper(const std::string& dev) { developer = StringDictionary::getInstance()->intern(dev); }
+void Product::setPublisher(const std::string& pub) 
+{
+    auto updated = editDetails();
+    updated->publisher = StringDictionary::getInstance()->intern(pub);
+    std::atomic_store(&details, updated);
+}
+
+void Product::setGenre(const std::string& newGenre) { genre = StringDictionary::getInstance()->intern(newGenre); }
 void Product::setAgeRating(int rating) { ageRating = rating; }
-void Product::setDescription(const std::string& desc) { description = desc; }
 void Product::setAverageRating(double rating) { averageRating = rating; }
-void Product::setTags(const std::vector<std::string>& newTags) { tags = newTags; }
+void Product::setTags(const std::vector<std::string>& newTags) { tags = StringDictionary::getInstance()->internAll(newTags); }
 void Product::setActivationKeys(int keys) { activationKeys = keys; }
+void Product::setLastSaleId(int saleId) { lastSaleId = saleId; }
+
+void Product::setDescription(const std::string& desc) 
+{
+    auto updated = editDetails();
+    updated->description = desc;
+    std::atomic_store(&details, updated);
+}
+
+void Product::setReleaseDate(const std::string& date) 
+{
+    auto updated = editDetails();
+    updated->releaseDate = date;
+    std::atomic_store(&details, updated);
+}
+
+//    :    ,
+//  ,   ,    
+std::shared_ptr<ProductDetails> Product::editDetails() 
+{
+    auto updated = std::make_shared<ProductDetails>(*getDetails());
+    updated->productId = id;
+    return updated;
+}
+
+std::shared_ptr<const ProductDetails> Product::getDetails() const 
+{
+    auto current = std::atomic_load(&details);
+    if (current) 
+    {
+        return current;
+    }
+
+    std::shared_ptr<ProductDetails> loaded;
+    if (detailsSource) 
+    {
+        loaded = detailsSource->load(id);
+    }
+    if (!loaded) 
+    {
+        loaded = std::make_shared<ProductDetails>();
+        loaded->productId = id;
+    }
+    std::atomic_store(&details, loaded);
+    return loaded;
+}
+
+bool Product::hasDetailsLoaded() const 
+{
+    return std::atomic_load(&details) != nullptr;
+}
+
+void Product::attachDetails(std::shared_ptr<ProductDetailsStore> source) 
+{
+    detailsSource = source;
+}
+
+void Product::releaseDetails() 
+{
+    if (detailsSource) 
+    {
+        std::atomic_store(&details, std::shared_ptr<ProductDetails>());
+    }
+}
 
 void Product::addTag(const std::string& tag) 
 {
-    tags.push_back(tag);
+    tags.push_back(StringDictionary::getInstance()->intern(tag));
 }
 
 void Product::removeTag(const std::string& tag) 
 {
-    tags.erase(std::remove(tags.begin(), tags.end(), tag), tags.end());
+    StringId tagId;
+    if (StringDictionary::getInstance()->find(tag, tagId)) 
+    {
+        tags.erase(std::remove(tags.begin(), tags.end(), tagId), tags.end());
+    }
 }
 
 bool Product::hasTag(const std::string& tag) const
+{
+    StringId tagId;
+    return StringDictionary::getInstance()->find(tag, tagId) && hasTagId(tagId);
+}
+
+bool Product::hasTagId(StringId tag) const 
 {
     return std::find(tags.begin(), tags.end(), tag) != tags.end();
 }
@@ -70,98 +158,14 @@ void Product::addKeys(int count)
     activationKeys += count;
 }
 
-void Product::serialize(std::ostream& os) const
+void Product::serialize(BinaryWriter& out) const
 {
-    os.write(reinterpret_cast<const char*>(&id), sizeof(id));
-
-    size_t size = title.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(title.c_str(), size);
-
-    os.write(reinterpret_cast<const char*>(&basePrice), sizeof(basePrice));
-
-    size = developer.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(developer.c_str(), size);
-
-    size = publisher.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(publisher.c_str(), size);
-
-    size = genre.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(genre.c_str(), size);
-
-    os.write(reinterpret_cast<const char*>(&ageRating), sizeof(ageRating));
-
-    size = description.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(description.c_str(), size);
-
-    size = releaseDate.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(releaseDate.c_str(), size);
-
-    os.write(reinterpret_cast<const char*>(&averageRating), sizeof(averageRating));
-    os.write(reinterpret_cast<const char*>(&activationKeys), sizeof(activationKeys));
-
-    size_t tagsSize = tags.size();
-    os.write(reinterpret_cast<const char*>(&tagsSize), sizeof(tagsSize));
-    for (const auto& tag : tags) 
-    {
-        size_t tagSize = tag.size();
-        os.write(reinterpret_cast<const char*>(&tagSize), sizeof(tagSize));
-        os.write(tag.c_str(), tagSize);
-    }
+    Schema::write(out, *this);
 }
 
-void Product::deserialize(std::istream& is) 
+void Product::deserialize(BinaryReader& in, uint16_t schemaRevision) 
 {
-    is.read(reinterpret_cast<char*>(&id), sizeof(id));
-
-    size_t size;
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    title.resize(size);
-    is.read(&title[0], size);
-
-    is.read(reinterpret_cast<char*>(&basePrice), sizeof(basePrice));
-
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    developer.resize(size);
-    is.read(&developer[0], size);
-
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    publisher.resize(size);
-    is.read(&publisher[0], size);
-
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    genre.resize(size);
-    is.read(&genre[0], size);
-
-    is.read(reinterpret_cast<char*>(&ageRating), sizeof(ageRating));
-
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    description.resize(size);
-    is.read(&description[0], size);
-
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    releaseDate.resize(size);
-    is.read(&releaseDate[0], size);
-
-    is.read(reinterpret_cast<char*>(&averageRating), sizeof(averageRating));
-    is.read(reinterpret_cast<char*>(&activationKeys), sizeof(activationKeys));
-
-    size_t tagsSize;
-    is.read(reinterpret_cast<char*>(&tagsSize), sizeof(tagsSize));
-    tags.resize(tagsSize);
-    for (size_t i = 0; i < tagsSize; ++i) 
-    {
-        size_t tagSize;
-        is.read(reinterpret_cast<char*>(&tagSize), sizeof(tagSize));
-        std::string tag(tagSize, ' ');
-        is.read(&tag[0], tagSize);
-        tags[i] = tag;
-    }
+    Schema::read(in, *this, schemaRevision);
 }
 
 std::string Product::getShortTitle() const 
@@ -175,6 +179,7 @@ std::string Product::getShortTitle() const
 
 std::string Product::getShortDescription() const 
 {
+    const std::string& description = getDetails()->description;
     if (description.length() > 50) 
     {
         return description.substr(0, 47) + "...";
@@ -197,15 +202,16 @@ void Game::displayInfo() const
     std::cout << "===    ===" << std::endl;
     Config::resetColor();
 
+    auto info = getDetails();
     std::cout << "ID: " << id << std::endl;
     std::cout << ": " << title << std::endl;
     std::cout << ": " << basePrice << " ." << std::endl;
-    std::cout << ": " << developer << std::endl;
-    std::cout << ": " << publisher << std::endl;
-    std::cout << ": " << genre << std::endl;
+    std::cout << ": " << getDeveloper() << std::endl;
+    std::cout << ": " << getPublisher() << std::endl;
+    std::cout << ": " << getGenre() << std::endl;
     std::cout << " : " << ageRating << "+" << std::endl;
-    std::cout << ": " << description << std::endl;
-    std::cout << " : " << releaseDate << std::endl;
+    std::cout << ": " << info->description << std::endl;
+    std::cout << " : " << info->releaseDate << std::endl;
     std::cout << ": " << averageRating << "/5" << std::endl;
     std::cout << "  : " << activationKeys << std::endl;
 
@@ -214,7 +220,7 @@ void Game::displayInfo() const
         std::cout << ": ";
         for (size_t i = 0; i < tags.size(); ++i) 
         {
-            std::cout << tags[i];
+            std::cout << StringDictionary::getInstance()->text(tags[i]);
             if (i < tags.size() - 1) std::cout << ", ";
         }
         std::cout << std::endl;
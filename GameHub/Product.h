@@ -5,6 +5,31 @@
 #include <memory>
 #include "Config.h"
 #include "Exceptions.h"
+#include "BinaryCodec.h"
+#include "Schema.h"
+#include "StringDictionary.h"
+
+class ProductDetailsStore;
+
+//    .      product_details.dat
+//     
+struct ProductDetails 
+{
+    int productId;
+    StringId publisher;
+    std::string description;
+    std::string releaseDate;
+
+    ProductDetails() : productId(0), publisher(StringDictionary::EMPTY) {}
+
+    static auto fields() 
+    {
+        return std::make_tuple(
+            Schema::field(&ProductDetails::productId),
+            Schema::converted<1, 3, std::string>(&ProductDetails::publisher), Schema::field<3>(&ProductDetails::publisher),
+            Schema::field(&ProductDetails::description), Schema::field(&ProductDetails::releaseDate));
+    }
+};
 
 class Product 
 {
@@ -12,15 +37,36 @@ protected:
     int id;
     std::string title;
     double basePrice;
-    std::string developer;
-    std::string publisher;
-    std::string genre;
+    StringId developer;
+    StringId genre;
     int ageRating;
-    std::string description;
-    std::string releaseDate;
     double averageRating;
-    std::vector<std::string> tags;
+    std::vector<StringId> tags;
     int activationKeys;
+    int lastSaleId;
+    mutable std::shared_ptr<ProductDetails> details;
+    std::shared_ptr<ProductDetailsStore> detailsSource;
+
+    //   2 ,         ,
+    //   3 ,     ,    .
+    //   4     ,        
+    friend struct Schema::Access;
+    static auto fields() 
+    {
+        return std::make_tuple(
+            Schema::field(&Product::id), Schema::field(&Product::title), Schema::field(&Product::basePrice),
+            Schema::converted<1, 3, std::string>(&Product::developer), Schema::field<3>(&Product::developer),
+            Schema::converted<1, 2, std::string>(&Product::details, &ProductDetails::publisher),
+            Schema::converted<1, 3, std::string>(&Product::genre), Schema::field<3>(&Product::genre),
+            Schema::field(&Product::ageRating),
+            Schema::field<1, 2>(&Product::details, &ProductDetails::description),
+            Schema::field<1, 2>(&Product::details, &ProductDetails::releaseDate),
+            Schema::field(&Product::averageRating), Schema::field(&Product::activationKeys),
+            Schema::converted<1, 3, std::vector<std::string>>(&Product::tags), Schema::field<3>(&Product::tags),
+            Schema::field<4>(&Product::lastSaleId));
+    }
+
+    std::shared_ptr<ProductDetails> editDetails();
 
 public:
     Product();
@@ -32,15 +78,24 @@ public:
     int getId() const;
     std::string getTitle() const;
     double getBasePrice() const;
-    std::string getDeveloper() const;
+    const std::string& getDeveloper() const;
     std::string getPublisher() const;
-    std::string getGenre() const;
+    const std::string& getGenre() const;
+    StringId getDeveloperId() const;
+    StringId getGenreId() const;
+    const std::vector<StringId>& getTagIds() const;
     int getAgeRating() const;
     std::string getDescription() const;
     std::string getReleaseDate() const;
     double getAverageRating() const;
     std::vector<std::string> getTags() const;
     int getActivationKeys() const;
+    int getLastSaleId() const;
+
+    std::shared_ptr<const ProductDetails> getDetails() const;
+    bool hasDetailsLoaded() const;
+    void attachDetails(std::shared_ptr<ProductDetailsStore> source);
+    void releaseDetails();
 
     void setTitle(const std::string& newTitle);
     void setBasePrice(double price);
@@ -49,13 +104,16 @@ public:
     void setGenre(const std::string& newGenre);
     void setAgeRating(int rating);
     void setDescription(const std::string& desc);
+    void setReleaseDate(const std::string& date);
     void setAverageRating(double rating);
     void setTags(const std::vector<std::string>& newTags);
     void setActivationKeys(int keys);
+    void setLastSaleId(int saleId);
 
     void addTag(const std::string& tag);
     void removeTag(const std::string& tag);
     bool hasTag(const std::string& tag) const;
+    bool hasTagId(StringId tag) const;
 
     bool hasKeys() const;
     bool reserveKeys(int count);
@@ -64,8 +122,8 @@ public:
     virtual void displayInfo() const = 0;
     virtual std::string getProductType() const = 0;
 
-    virtual void serialize(std::ostream& os) const;
-    virtual void deserialize(std::istream& is);
+    virtual void serialize(BinaryWriter& out) const;
+    virtual void deserialize(BinaryReader& in, uint16_t schemaRevision);
 
     std::string getShortTitle() const;
     std::string getShortDescription() const;
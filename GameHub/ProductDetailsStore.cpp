@@ -0,0 +1,114 @@
+#include "ProductDetailsStore.h"
+
+ProductDetailsStore::ProductDetailsStore(const std::string& detailsFile) : filename(detailsFile), revision(Schema::BASE_REVISION) 
+{
+    logger = Logger::getInstance();
+    open();
+}
+
+void ProductDetailsStore::open() 
+{
+    try 
+    {
+        reader.reset(new DataFileReader(filename));
+        if (!reader->exists()) 
+        {
+            reader.reset();
+            return;
+        }
+
+        revision = reader->getSchemaRevision();
+        if (revision > Schema::revision<ProductDetails>()) 
+        {
+            throw FileIOException("Schema revision " + std::to_string(revision) + " is newer than supported");
+        }
+
+        //          
+        size_t count = reader->getRecordCount();
+        records.reserve(count);
+        for (size_t i = 0; i < count; ++i) 
+        {
+            BinaryReader& record = reader->nextRecord();
+            const char* begin = record.position();
+            int productId = record.read<int>();
+            if (revision < 3) 
+            {
+                record.readStringRef();
+            }
+            else 
+            {
+                record.read<StringId>();
+            }
+            record.readStringRef();
+            record.readStringRef();
+            records[productId] = std::make_pair(begin, record.position());
+        }
+        reader->finish();
+    }
+    catch (const std::exception& e) 
+    {
+        records.clear();
+        reader.reset();
+        logger->log(LogLevel::ERR, "Failed to map product details from " + filename + ": " + e.what());
+    }
+}
+
+void ProductDetailsStore::close() 
+{
+    records.clear();
+    reader.reset();
+}
+
+std::shared_ptr<ProductDetails> ProductDetailsStore::load(int productId) const 
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = records.find(productId);
+    if (it == records.end()) 
+    {
+        return nullptr;
+    }
+
+    auto details = std::make_shared<ProductDetails>();
+    BinaryReader record(it->second.first, it->second.second);
+    Schema::read(record, *details, revision);
+    return details;
+}
+
+bool ProductDetailsStore::save(const std::vector<std::shared_ptr<Product>>& products) 
+{
+    std::vector<ProductDetails> contents;
+    std::vector<bool> loaded;
+    contents.reserve(products.size());
+    loaded.reserve(products.size());
+    for (const auto& product : products) 
+    {
+        loaded.push_back(product->hasDetailsLoaded());
+        contents.push_back(*product->getDetails());
+        contents.back().productId = product->getId();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    //     ,     
+    close();
+    bool saved = fileManager.saveToFile(filename, contents);
+    open();
+
+    // ,     ,  
+    if (saved && records.size() == contents.size()) 
+    {
+        for (size_t i = 0; i < products.size(); ++i) 
+        {
+            if (!loaded[i]) 
+            {
+                products[i]->releaseDetails();
+            }
+        }
+    }
+    return saved;
+}
+
+size_t ProductDetailsStore::size() const 
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return records.size();
+}
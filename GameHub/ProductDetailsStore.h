@@ -0,0 +1,37 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "DataFile.h"
+#include "FileManager.h"
+#include "Product.h"
+#include "Logger.h"
+
+//      (, ,  ).
+//     ,       .
+class ProductDetailsStore 
+{
+private:
+    std::string filename;
+    std::unique_ptr<DataFileReader> reader;
+    std::unordered_map<int, std::pair<const char*, const char*>> records;
+    uint16_t revision;
+    FileManager fileManager;
+    Logger* logger;
+    mutable std::mutex mutex;
+
+    void open();
+    void close();
+
+    ProductDetailsStore(const ProductDetailsStore&) = delete;
+    ProductDetailsStore& operator=(const ProductDetailsStore&) = delete;
+
+public:
+    explicit ProductDetailsStore(const std::string& detailsFile);
+
+    std::shared_ptr<ProductDetails> load(int productId) const;
+    bool save(const std::vector<std::shared_ptr<Product>>& products);
+    size_t size() const;
+};
@@ -0,0 +1,139 @@
+#include "ProductFileView.h"
+
+ProductView::ProductView(const char* record, const char* limit, uint16_t schemaRevision) : begin(record), revision(schemaRevision) 
+{
+    //   2     ,    
+    BinaryReader cursor(record, limit);
+    type = cursor.readStringRef();
+    id = cursor.read<int>();
+    title = cursor.readStringRef();
+    basePrice = cursor.read<double>();
+    developer = readText(cursor);
+    if (revision < 2) 
+    {
+        cursor.readStringRef();
+    }
+    genre = readText(cursor);
+    ageRating = cursor.read<int>();
+    if (revision < 2) 
+    {
+        cursor.readStringRef();
+        cursor.readStringRef();
+    }
+    averageRating = cursor.read<double>();
+    activationKeys = cursor.read<int>();
+    tagCount = cursor.read<size_t>();
+    tagsBegin = cursor.position();
+    for (size_t i = 0; i < tagCount; ++i) 
+    {
+        readText(cursor);
+    }
+    if (revision >= 4) 
+    {
+        cursor.read<int>();
+    }
+    size = static_cast<size_t>(cursor.position() - record);
+}
+
+StringRef ProductView::readText(BinaryReader& cursor) const 
+{
+    if (revision < 3) 
+    {
+        return cursor.readStringRef();
+    }
+    const std::string& text = StringDictionary::getInstance()->text(cursor.read<StringId>());
+    return StringRef(text.data(), text.size());
+}
+
+size_t ProductView::getSize() const { return size; }
+StringRef ProductView::getType() const { return type; }
+int ProductView::getId() const { return id; }
+StringRef ProductView::getTitle() const { return title; }
+double ProductView::getBasePrice() const { return basePrice; }
+StringRef ProductView::getDeveloper() const { return developer; }
+StringRef ProductView::getGenre() const { return genre; }
+int ProductView::getAgeRating() const { return ageRating; }
+double ProductView::getAverageRating() const { return averageRating; }
+int ProductView::getActivationKeys() const { return activationKeys; }
+
+std::vector<StringRef> ProductView::getTags() const 
+{
+    std::vector<StringRef> tags;
+    tags.reserve(tagCount);
+    BinaryReader cursor(tagsBegin, begin + size);
+    for (size_t i = 0; i < tagCount; ++i) 
+    {
+        tags.push_back(readText(cursor));
+    }
+    return tags;
+}
+
+std::shared_ptr<Product> ProductView::materialize() const 
+{
+    std::shared_ptr<Product> product;
+    if (type == "Game") 
+    {
+        product = std::make_shared<Game>();
+    }
+    else 
+    {
+        throw FileIOException("Unknown product type: " + type.str());
+    }
+
+    const char* fields = type.data + type.size;
+    BinaryReader fieldReader(fields, begin + size);
+    product->deserialize(fieldReader, revision);
+    return product;
+}
+
+ProductFileView::ProductFileView(const std::string& filename) : revision(Schema::revision<Product>()) 
+{
+    logger = Logger::getInstance();
+    try 
+    {
+        reader.reset(new DataFileReader(filename));
+        if (!reader->exists()) 
+        {
+            return;
+        }
+        //        1-3
+        revision = reader->getSchemaRevision();
+        if (revision > Schema::revision<Product>()) 
+        {
+            throw FileIOException("schema revision " + std::to_string(revision) + " is not supported by the view");
+        }
+
+        size_t count = reader->getRecordCount();
+        records.reserve(count);
+        sizes.reserve(count);
+        for (size_t i = 0; i < count; ++i) 
+        {
+            reader->nextRecord();
+            ProductView view(reader->position(), reader->blockEnd(), revision);
+            records.push_back(reader->position());
+            sizes.push_back(view.getSize());
+            reader->skip(view.getSize());
+        }
+        reader->finish();
+    }
+    catch (const std::exception& e) 
+    {
+        records.clear();
+        sizes.clear();
+        reader.reset();
+        logger->log(LogLevel::ERR, "Failed to map products from " + filename + ": " + e.what());
+    }
+}
+
+size_t ProductFileView::size() const { return records.size(); }
+bool ProductFileView::empty() const { return records.empty(); }
+
+ProductView ProductFileView::operator[](size_t index) const 
+{
+    return ProductView(records[index], records[index] + sizes[index], revision);
+}
+
+std::shared_ptr<Product> ProductFileView::materialize(size_t index) const 
+{
+    return (*this)[index].materialize();
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <memory>
+#include "DataFile.h"
+#include "MappedFile.h"
+#include "Product.h"
+#include "Logger.h"
+
+//  ,     products.dat.    ,
+//     3 ,    -   .
+class ProductView 
+{
+private:
+    const char* begin;
+    size_t size;
+    uint16_t revision;
+    StringRef type;
+    int id;
+    StringRef title;
+    double basePrice;
+    StringRef developer;
+    StringRef genre;
+    int ageRating;
+    double averageRating;
+    int activationKeys;
+    size_t tagCount;
+    const char* tagsBegin;
+
+    StringRef readText(BinaryReader& cursor) const;
+
+public:
+    ProductView(const char* record, const char* limit, uint16_t schemaRevision);
+
+    size_t getSize() const;
+    StringRef getType() const;
+    int getId() const;
+    StringRef getTitle() const;
+    double getBasePrice() const;
+    StringRef getDeveloper() const;
+    StringRef getGenre() const;
+    int getAgeRating() const;
+    double getAverageRating() const;
+    int getActivationKeys() const;
+    std::vector<StringRef> getTags() const;
+
+    std::shared_ptr<Product> materialize() const;
+};
+
+// products.dat,   :    ,
+//   Product    materialize
+class ProductFileView 
+{
+private:
+    std::unique_ptr<DataFileReader> reader;
+    std::vector<const char*> records;
+    std::vector<size_t> sizes;
+    uint16_t revision;
+    Logger* logger;
+
+    ProductFileView(const ProductFileView&) = delete;
+    ProductFileView& operator=(const ProductFileView&) = delete;
+
+public:
+    explicit ProductFileView(const std::string& filename);
+
+    size_t size() const;
+    bool empty() const;
+    ProductView operator[](size_t index) const;
+    std::shared_ptr<Product> materialize(size_t index) const;
+};
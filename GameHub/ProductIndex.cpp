@@ -0,0 +1,200 @@
+#include "ProductIndex.h"
+
+void ProductIndex::addTo(Index& index, StringId key, int productId) 
+{
+    index[key].insert(productId);
+}
+
+void ProductIndex::removeFrom(Index& index, StringId key, int productId) 
+{
+    auto it = index.find(key);
+    if (it == index.end()) 
+    {
+        return;
+    }
+
+    it->second.erase(productId);
+    if (it->second.empty()) 
+    {
+        index.erase(it);
+    }
+}
+
+const std::set<int>& ProductIndex::lookup(const Index& index, const std::string& key) 
+{
+    static const std::set<int> empty;
+    StringId id;
+    if (!StringDictionary::getInstance()->find(key, id)) 
+    {
+        return empty;
+    }
+    auto it = index.find(id);
+    return it != index.end() ? it->second : empty;
+}
+
+std::vector<std::string> ProductIndex::keys(const Index& index) 
+{
+    std::vector<std::string> result;
+    result.reserve(index.size());
+    for (const auto& entry : index) 
+    {
+        result.push_back(StringDictionary::getInstance()->text(entry.first));
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+void ProductIndex::writeIds(BinaryWriter& writer, const std::set<int>& ids) 
+{
+    writer.write<uint64_t>(ids.size());
+    for (int id : ids) 
+    {
+        writer.write(id);
+    }
+}
+
+void ProductIndex::readIds(BinaryReader& reader, std::set<int>& ids) 
+{
+    //    ,       
+    uint64_t count = reader.read<uint64_t>();
+    for (uint64_t i = 0; i < count; ++i) 
+    {
+        ids.insert(ids.end(), reader.read<int>());
+    }
+}
+
+void ProductIndex::writeIndex(BinaryWriter& writer, const Index& index) 
+{
+    writer.write<uint64_t>(index.size());
+    for (const auto& entry : index) 
+    {
+        writer.write(entry.first);
+        writeIds(writer, entry.second);
+    }
+}
+
+void ProductIndex::readIndex(BinaryReader& reader, Index& index) 
+{
+    uint64_t count = reader.read<uint64_t>();
+    index.reserve(static_cast<size_t>((std::min)(count, static_cast<uint64_t>(reader.remaining()))));
+    for (uint64_t i = 0; i < count; ++i) 
+    {
+        StringId key = reader.read<StringId>();
+        readIds(reader, index[key]);
+    }
+}
+
+void ProductIndex::clear() 
+{
+    genreIndex.clear();
+    developerIndex.clear();
+    tagIndex.clear();
+    inStockIds.clear();
+    discountedIds.clear();
+}
+
+void ProductIndex::addProduct(const Product& product) 
+{
+    int productId = product.getId();
+    addTo(genreIndex, product.getGenreId(), productId);
+    addTo(developerIndex, product.getDeveloperId(), productId);
+    for (StringId tag : product.getTagIds()) 
+    {
+        addTo(tagIndex, tag, productId);
+    }
+    updateStock(product);
+}
+
+void ProductIndex::removeProduct(const Product& product) 
+{
+    int productId = product.getId();
+    removeFrom(genreIndex, product.getGenreId(), productId);
+    removeFrom(developerIndex, product.getDeveloperId(), productId);
+    for (StringId tag : product.getTagIds()) 
+    {
+        removeFrom(tagIndex, tag, productId);
+    }
+    inStockIds.erase(productId);
+    discountedIds.erase(productId);
+}
+
+void ProductIndex::updateStock(const Product& product) 
+{
+    if (product.hasKeys()) 
+    {
+        inStockIds.insert(product.getId());
+    }
+    else 
+    {
+        inStockIds.erase(product.getId());
+    }
+}
+
+void ProductIndex::setDiscounted(int productId, bool discounted) 
+{
+    if (discounted) 
+    {
+        discountedIds.insert(productId);
+    }
+    else 
+    {
+        discountedIds.erase(productId);
+    }
+}
+
+void ProductIndex::clearDiscounted() 
+{
+    discountedIds.clear();
+}
+
+void ProductIndex::write(BinaryWriter& writer) const 
+{
+    writeIndex(writer, genreIndex);
+    writeIndex(writer, developerIndex);
+    writeIndex(writer, tagIndex);
+    writeIds(writer, inStockIds);
+}
+
+void ProductIndex::read(BinaryReader& reader) 
+{
+    clear();
+    readIndex(reader, genreIndex);
+    readIndex(reader, developerIndex);
+    readIndex(reader, tagIndex);
+    readIds(reader, inStockIds);
+}
+
+const std::set<int>& ProductIndex::getByGenre(const std::string& genre) const 
+{
+    return lookup(genreIndex, genre);
+}
+
+const std::set<int>& ProductIndex::getByDeveloper(const std::string& developer) const 
+{
+    return lookup(developerIndex, developer);
+}
+
+const std::set<int>& ProductIndex::getByTag(const std::string& tag) const 
+{
+    return lookup(tagIndex, tag);
+}
+
+const std::set<int>& ProductIndex::getInStock() const 
+{
+    return inStockIds;
+}
+
+const std::set<int>& ProductIndex::getDiscounted() const 
+{
+    return discountedIds;
+}
+
+std::vector<std::string> ProductIndex::getGenres() const 
+{
+    return keys(genreIndex);
+}
+
+std::vector<std::string> ProductIndex::getDevelopers() const 
+{
+    return keys(developerIndex);
+}
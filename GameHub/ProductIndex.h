@@ -0,0 +1,52 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <set>
+#include "Product.h"
+#include "BinaryCodec.h"
+
+//   ,       ,    
+class ProductIndex 
+{
+private:
+    typedef std::unordered_map<StringId, std::set<int>> Index;
+
+    Index genreIndex;
+    Index developerIndex;
+    Index tagIndex;
+    std::set<int> inStockIds;
+    std::set<int> discountedIds;
+
+    static void addTo(Index& index, StringId key, int productId);
+    static void removeFrom(Index& index, StringId key, int productId);
+    static const std::set<int>& lookup(const Index& index, const std::string& key);
+    static std::vector<std::string> keys(const Index& index);
+    static void writeIds(BinaryWriter& writer, const std::set<int>& ids);
+    static void readIds(BinaryReader& reader, std::set<int>& ids);
+    static void writeIndex(BinaryWriter& writer, const Index& index);
+    static void readIndex(BinaryReader& reader, Index& index);
+
+public:
+    void clear();
+
+    void addProduct(const Product& product);
+    void removeProduct(const Product& product);
+    void updateStock(const Product& product);
+    void setDiscounted(int productId, bool discounted);
+    void clearDiscounted();
+
+    //          ,   
+    void write(BinaryWriter& writer) const;
+    void read(BinaryReader& reader);
+
+    const std::set<int>& getByGenre(const std::string& genre) const;
+    const std::set<int>& getByDeveloper(const std::string& developer) const;
+    const std::set<int>& getByTag(const std::string& tag) const;
+    const std::set<int>& getInStock() const;
+    const std::set<int>& getDiscounted() const;
+
+    std::vector<std::string> getGenres() const;
+    std::vector<std::string> getDevelopers() const;
+};
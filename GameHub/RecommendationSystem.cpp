@@ -21,32 +21,45 @@ std::vector<std::shared_ptr<Product>> RecommendationSystem::getSimilarGames(std:
         return recommendations;
     }
 
-    std::string targetGenre = lastPurchasedProduct->getGenre();
-    std::vector<std::string> targetTags = lastPurchasedProduct->getTags();
+    const std::vector<StringId>& targetTags = lastPurchasedProduct->getTagIds();
 
-    auto allProducts = store.getAllProducts();
-    for (const auto& product : allProducts) 
+    //     ;       
+    const HotProductTable& hotProducts = store.getHotProducts();
+    HotProduct target = hotProducts.describe(*lastPurchasedProduct);
+    uint64_t targetMask = target.tagMask & ~HotProductTable::TAG_OVERFLOW;
+    bool compareTags = (target.tagMask & HotProductTable::TAG_OVERFLOW) != 0;
+
+    auto allProducts = store.getProductsSnapshot();
+    for (size_t slot = 0; slot < allProducts.size(); ++slot) 
     {
-        if (product->getId() == customer->getLastPurchasedProductId()) 
+        const HotProduct& row = hotProducts[slot];
+        if (row.id == customer->getLastPurchasedProductId()) 
         {
             continue;
         }
 
-        if (product->getGenre() == targetGenre) 
+        const auto& product = allProducts[slot];
+        bool similar = row.genreId == target.genreId;
+        if (!similar) 
         {
-            recommendations.push_back(product);
+            similar = (row.tagMask & targetMask) != 0;
         }
-        else
+        if (!similar && compareTags && (row.tagMask & HotProductTable::TAG_OVERFLOW)) 
         {
-            for (const auto& tag : targetTags) 
+            for (StringId tag : targetTags) 
             {
-                if (product->hasTag(tag))
+                if (product->hasTagId(tag))
                 {
-                    recommendations.push_back(product);
+                    similar = true;
                     break;
                 }
             }
         }
+
+        if (similar) 
+        {
+            recommendations.push_back(product);
+        }
     }
 
     std::sort(recommendations.begin(), recommendations.end(),
@@ -70,7 +83,7 @@ std::vector<std::shared_ptr<Product>> RecommendationSystem::getSimilarGames(std:
 
 std::vector<std::shared_ptr<Product>> RecommendationSystem::getDiscountedProducts() 
 {
-    auto allProducts = store.getAllProducts();
+    auto allProducts = store.getProductsSnapshot();
     std::vector<std::shared_ptr<Product>> discounted;
 
     for (const auto& product : allProducts) 
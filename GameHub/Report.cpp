@@ -5,30 +5,26 @@ Report::Report(Store& storeRef) : store(storeRef)
     logger = Logger::getInstance();
 }
 
-Report::SalesReport Report::generateSalesReport(const std::string& startDate, const std::string& endDate) 
+Report::SalesReport Report::generateSalesReport(const Timestamp& startDate, const Timestamp& endDate) 
 {
     SalesReport report;
-    report.period = startDate + " - " + endDate;
+    report.period = startDate.toString() + " - " + endDate.toString();
     report.totalRevenue = 0.0;
     report.totalSales = 0;
 
-    std::map<int, int> productSales;
-
-    auto allSales = store.getAllSales();
-    for (const auto& sale : allSales) 
+    if (!startDate.isSet() || !endDate.isSet()) 
     {
-        if (sale.getSaleDateTime() >= startDate && sale.getSaleDateTime() <= endDate) 
-        {
-            report.totalRevenue += sale.getFinalAmount();
-            report.totalSales++;
-
-            for (const auto& item : sale.getItems()) 
-            {
-                productSales[item.first] += item.second;
-            }
-        }
+        logger->log(LogLevel::WARNING, "Invalid report period: " + report.period);
+        return report;
     }
+    std::time_t start = static_cast<std::time_t>(startDate.getSeconds());
+    std::time_t end = static_cast<std::time_t>(endDate.getSeconds());
 
+    SalesCube::Bucket totals = store.collectSales(start, end);
+    report.totalRevenue = totals.revenue;
+    report.totalSales = totals.transactions;
+
+    const std::map<int, int>& productSales = totals.productUnits;
     std::vector<std::pair<int, int>> productVector(productSales.begin(), productSales.end());
     std::sort(productVector.begin(), productVector.end(),
         [](const std::pair<int, int>& a, const std::pair<int, int>& b) 
@@ -47,24 +43,27 @@ Report::SalesReport Report::generateSalesReport(const std::string& startDate, co
     return report;
 }
 
-Report::FinancialReport Report::generateFinancialReport(const std::string& startDate, const std::string& endDate) 
+Report::FinancialReport Report::generateFinancialReport(const Timestamp& startDate, const Timestamp& endDate) 
 {
     FinancialReport report;
-    report.period = startDate + " - " + endDate;
+    report.period = startDate.toString() + " - " + endDate.toString();
     report.totalRevenue = 0.0;
     report.totalDiscounts = 0.0;
     report.totalTransactions = 0;
+    report.averageTransactionValue = 0.0;
 
-    auto allSales = store.getAllSales();
-    for (const auto& sale : allSales) 
+    if (!startDate.isSet() || !endDate.isSet()) 
     {
-        if (sale.getSaleDateTime() >= startDate && sale.getSaleDateTime() <= endDate) 
-        {
-            report.totalRevenue += sale.getFinalAmount();
-            report.totalDiscounts += sale.getDiscountAmount();
-            report.totalTransactions++;
-        }
+        logger->log(LogLevel::WARNING, "Invalid report period: " + report.period);
+        return report;
     }
+    std::time_t start = static_cast<std::time_t>(startDate.getSeconds());
+    std::time_t end = static_cast<std::time_t>(endDate.getSeconds());
+
+    SalesCube::Bucket totals = store.collectSales(start, end);
+    report.totalRevenue = totals.revenue;
+    report.totalDiscounts = totals.discounts;
+    report.totalTransactions = totals.transactions;
 
     report.averageTransactionValue = report.totalTransactions > 0 ?
         report.totalRevenue / report.totalTransactions : 0.0;
@@ -149,7 +148,7 @@ void Report::generateInventoryReport()
     std::cout << "===     ===" << std::endl;
     Config::resetColor();
 
-    auto products = store.getAllProducts();
+    auto products = store.getProductsSnapshot();
     int lowStockCount = 0;
 
     for (const auto& product : products) 
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <fstream>
 #include "Sale.h"
+#include "Timestamp.h"
 #include "Product.h"
 #include "Store.h"
 #include "FileManager.h"
@@ -38,8 +39,8 @@ public:
         double averageTransactionValue;
     };
 
-    SalesReport generateSalesReport(const std::string& startDate, const std::string& endDate);
-    FinancialReport generateFinancialReport(const std::string& startDate, const std::string& endDate);
+    SalesReport generateSalesReport(const Timestamp& startDate, const Timestamp& endDate);
+    FinancialReport generateFinancialReport(const Timestamp& startDate, const Timestamp& endDate);
 
     void saveReportToFile(const SalesReport& report, const std::string& filename);
     void saveReportToFile(const FinancialReport& report, const std::string& filename);
@@ -6,13 +6,13 @@ Sale::Sale(int saleId, int customerId, const std::vector<std::pair<int, int>>& i
     double totalAmount, double discountAmount, const std::string& status)
     : saleId(saleId), customerId(customerId), items(items),
     totalAmount(totalAmount), discountAmount(discountAmount), status(status) {
-    saleDateTime = Config::getCurrentDateTime();
+    saleDateTime = Timestamp::now();
 }
 
 int Sale::getSaleId() const { return saleId; }
 int Sale::getCustomerId() const { return customerId; }
-std::string Sale::getSaleDateTime() const { return saleDateTime; }
-std::vector<std::pair<int, int>> Sale::getItems() const { return items; }
+Timestamp Sale::getSaleDateTime() const { return saleDateTime; }
+const std::vector<std::pair<int, int>>& Sale::getItems() const { return items; }
 double Sale::getTotalAmount() const { return totalAmount; }
 double Sale::getDiscountAmount() const { return discountAmount; }
 std::string Sale::getStatus() const { return status; }
@@ -20,7 +20,7 @@ double Sale::getFinalAmount() const { return totalAmount - discountAmount; }
 
 void Sale::setSaleId(int id) { saleId = id; }
 void Sale::setCustomerId(int id) { customerId = id; }
-void Sale::setSaleDateTime(const std::string& datetime) { saleDateTime = datetime; }
+void Sale::setSaleDateTime(const Timestamp& datetime) { saleDateTime = datetime; }
 void Sale::setItems(const std::vector<std::pair<int, int>>& newItems) { items = newItems; }
 void Sale::setTotalAmount(double amount) { totalAmount = amount; }
 void Sale::setDiscountAmount(double amount) { discountAmount = amount; }
@@ -75,7 +75,7 @@ void Sale::displaySaleInfo() const
 
     std::cout << "ID : " << saleId << std::endl;
     std::cout << "ID : " << customerId << std::endl;
-    std::cout << "  : " << saleDateTime << std::endl;
+    std::cout << "  : " << saleDateTime.toString() << std::endl;
     std::cout << ": " << status << std::endl;
 
     Config::setColor(Config::COLOR_MENUU);
@@ -96,60 +96,6 @@ void Sale::displaySaleInfo() const
     std::cout << " : " << getFinalAmount() << " ." << std::endl;
 }
 
-void Sale::serialize(std::ostream& os) const 
-{
-    os.write(reinterpret_cast<const char*>(&saleId), sizeof(saleId));
-    os.write(reinterpret_cast<const char*>(&customerId), sizeof(customerId));
-
-    size_t size = saleDateTime.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(saleDateTime.c_str(), size);
-
-    size_t itemsSize = items.size();
-    os.write(reinterpret_cast<const char*>(&itemsSize), sizeof(itemsSize));
-    for (const auto& item : items) 
-    {
-        os.write(reinterpret_cast<const char*>(&item.first), sizeof(item.first));
-        os.write(reinterpret_cast<const char*>(&item.second), sizeof(item.second));
-    }
-
-    os.write(reinterpret_cast<const char*>(&totalAmount), sizeof(totalAmount));
-    os.write(reinterpret_cast<const char*>(&discountAmount), sizeof(discountAmount));
-
-    size = status.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(status.c_str(), size);
-}
-
-void Sale::deserialize(std::istream& is) 
-{
-    is.read(reinterpret_cast<char*>(&saleId), sizeof(saleId));
-    is.read(reinterpret_cast<char*>(&customerId), sizeof(customerId));
-
-    size_t size;
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    saleDateTime.resize(size);
-    is.read(&saleDateTime[0], size);
-
-    size_t itemsSize;
-    is.read(reinterpret_cast<char*>(&itemsSize), sizeof(itemsSize));
-    items.resize(itemsSize);
-    for (size_t i = 0; i < itemsSize; ++i) 
-    {
-        int productId, quantity;
-        is.read(reinterpret_cast<char*>(&productId), sizeof(productId));
-        is.read(reinterpret_cast<char*>(&quantity), sizeof(quantity));
-        items[i] = std::make_pair(productId, quantity);
-    }
-
-    is.read(reinterpret_cast<char*>(&totalAmount), sizeof(totalAmount));
-    is.read(reinterpret_cast<char*>(&discountAmount), sizeof(discountAmount));
-
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    status.resize(size);
-    is.read(&status[0], size);
-}
-
 bool Sale::containsProduct(int productId) const 
 {
     for (const auto& item : items) 
@@ -5,18 +5,30 @@
 #include <utility>
 #include "Config.h"
 #include "Exceptions.h"
+#include "Timestamp.h"
+#include "BinaryCodec.h"
+#include "Schema.h"
 
 class Sale 
 {
 private:
     int saleId;
     int customerId;
-    std::string saleDateTime;
+    Timestamp saleDateTime;
     std::vector<std::pair<int, int>> items;
     double totalAmount;
     double discountAmount;
     std::string status;
 
+    friend struct Schema::Access;
+    static auto fields() 
+    {
+        return std::make_tuple(
+            Schema::field(&Sale::saleId), Schema::field(&Sale::customerId), Schema::field(&Sale::saleDateTime),
+            Schema::field(&Sale::items), Schema::field(&Sale::totalAmount), Schema::field(&Sale::discountAmount),
+            Schema::field(&Sale::status));
+    }
+
 public:
     Sale();
     Sale(int saleId, int customerId, const std::vector<std::pair<int, int>>& items,
@@ -24,8 +36,8 @@ public:
 
     int getSaleId() const;
     int getCustomerId() const;
-    std::string getSaleDateTime() const;
-    std::vector<std::pair<int, int>> getItems() const;
+    Timestamp getSaleDateTime() const;
+    const std::vector<std::pair<int, int>>& getItems() const;
     double getTotalAmount() const;
     double getDiscountAmount() const;
     std::string getStatus() const;
@@ -33,7 +45,7 @@ public:
 
     void setSaleId(int id);
     void setCustomerId(int id);
-    void setSaleDateTime(const std::string& datetime);
+    void setSaleDateTime(const Timestamp& datetime);
     void setItems(const std::vector<std::pair<int, int>>& newItems);
     void setTotalAmount(double amount);
     void setDiscountAmount(double amount);
@@ -45,9 +57,6 @@ public:
 
     void displaySaleInfo() const;
 
-    void serialize(std::ostream& os) const;
-    void deserialize(std::istream& is);
-
     bool containsProduct(int productId) const;
     int getTotalItemsCount() const;
 };
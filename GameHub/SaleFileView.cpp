@@ -0,0 +1,101 @@
+#include "SaleFileView.h"
+
+SaleView::SaleView(const char* record, const char* limit) : begin(record) 
+{
+    BinaryReader cursor(record, limit);
+    saleId = cursor.read<int>();
+    customerId = cursor.read<int>();
+    saleDateTime.deserialize(cursor);
+
+    itemCount = cursor.read<size_t>();
+    itemsBegin = cursor.position();
+    if (itemCount > cursor.remaining() / (2 * sizeof(int))) 
+    {
+        throw FileIOException("Record field extends beyond record bounds");
+    }
+    cursor.skip(itemCount * 2 * sizeof(int));
+
+    totalAmount = cursor.read<double>();
+    discountAmount = cursor.read<double>();
+    status = cursor.readStringRef();
+    size = static_cast<size_t>(cursor.position() - record);
+}
+
+size_t SaleView::getSize() const { return size; }
+int SaleView::getSaleId() const { return saleId; }
+int SaleView::getCustomerId() const { return customerId; }
+Timestamp SaleView::getSaleDateTime() const { return saleDateTime; }
+size_t SaleView::getItemCount() const { return itemCount; }
+double SaleView::getTotalAmount() const { return totalAmount; }
+double SaleView::getDiscountAmount() const { return discountAmount; }
+double SaleView::getFinalAmount() const { return totalAmount - discountAmount; }
+StringRef SaleView::getStatus() const { return status; }
+
+std::pair<int, int> SaleView::getItem(size_t index) const 
+{
+    std::pair<int, int> item;
+    const char* position = itemsBegin + index * 2 * sizeof(int);
+    std::memcpy(&item.first, position, sizeof(int));
+    std::memcpy(&item.second, position + sizeof(int), sizeof(int));
+    return item;
+}
+
+Sale SaleView::materialize() const 
+{
+    BinaryReader reader(begin, begin + size);
+
+    Sale sale;
+    Schema::read(reader, sale);
+    return sale;
+}
+
+SaleFileView::SaleFileView(const std::string& filename) 
+{
+    logger = Logger::getInstance();
+    try 
+    {
+        reader.reset(new DataFileReader(filename));
+        if (!reader->exists()) 
+        {
+            return;
+        }
+        //         
+        if (reader->getSchemaRevision() != Schema::revision<Sale>()) 
+        {
+            throw FileIOException("schema revision " + std::to_string(reader->getSchemaRevision()) + " is not supported by the view");
+        }
+
+        size_t count = reader->getRecordCount();
+        records.reserve(count);
+        sizes.reserve(count);
+        for (size_t i = 0; i < count; ++i) 
+        {
+            reader->nextRecord();
+            SaleView view(reader->position(), reader->blockEnd());
+            records.push_back(reader->position());
+            sizes.push_back(view.getSize());
+            reader->skip(view.getSize());
+        }
+        reader->finish();
+    }
+    catch (const std::exception& e) 
+    {
+        records.clear();
+        sizes.clear();
+        reader.reset();
+        logger->log(LogLevel::ERR, "Failed to map sales from " + filename + ": " + e.what());
+    }
+}
+
+size_t SaleFileView::size() const { return records.size(); }
+bool SaleFileView::empty() const { return records.empty(); }
+
+SaleView SaleFileView::operator[](size_t index) const 
+{
+    return SaleView(records[index], records[index] + sizes[index]);
+}
+
+Sale SaleFileView::materialize(size_t index) const 
+{
+    return (*this)[index].materialize();
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+#include "DataFile.h"
+#include "MappedFile.h"
+#include "Sale.h"
+#include "Timestamp.h"
+#include "Logger.h"
+
+//  ,     sales.dat
+class SaleView 
+{
+private:
+    const char* begin;
+    size_t size;
+    int saleId;
+    int customerId;
+    Timestamp saleDateTime;
+    size_t itemCount;
+    const char* itemsBegin;
+    double totalAmount;
+    double discountAmount;
+    StringRef status;
+
+public:
+    SaleView(const char* record, const char* limit);
+
+    size_t getSize() const;
+    int getSaleId() const;
+    int getCustomerId() const;
+    Timestamp getSaleDateTime() const;
+    size_t getItemCount() const;
+    std::pair<int, int> getItem(size_t index) const;
+    double getTotalAmount() const;
+    double getDiscountAmount() const;
+    double getFinalAmount() const;
+    StringRef getStatus() const;
+
+    Sale materialize() const;
+};
+
+// sales.dat,   ,     
+class SaleFileView 
+{
+private:
+    std::unique_ptr<DataFileReader> reader;
+    std::vector<const char*> records;
+    std::vector<size_t> sizes;
+    Logger* logger;
+
+    SaleFileView(const SaleFileView&) = delete;
+    SaleFileView& operator=(const SaleFileView&) = delete;
+
+public:
+    explicit SaleFileView(const std::string& filename);
+
+    size_t size() const;
+    bool empty() const;
+    SaleView operator[](size_t index) const;
+    Sale materialize(size_t index) const;
+};
@@ -0,0 +1,156 @@
+#include "SaleJournal.h"
+#include "DataFile.h"
+#include <cstdio>
+#include <io.h>
+
+SaleJournal::SaleJournal(const std::string& journalFile) : filename(journalFile), recordCount(0) 
+{
+    logger = Logger::getInstance();
+}
+
+void SaleJournal::appendFrame(const Record& record, std::string& buffer) 
+{
+    BinaryWriter payload;
+    Schema::write(payload, record);
+
+    size_t length = payload.size();
+    uint32_t sum = DataFormat::crc32(payload.data(), payload.size());
+
+    buffer.reserve(buffer.size() + sizeof(length) + length + sizeof(sum));
+    buffer.append(reinterpret_cast<const char*>(&length), sizeof(length));
+    buffer.append(payload.data(), payload.size());
+    buffer.append(reinterpret_cast<const char*>(&sum), sizeof(sum));
+}
+
+void SaleJournal::writeFrames(const std::string& buffer, size_t count) 
+{
+    //     -   ,     
+    FILE* file = nullptr;
+    if (fopen_s(&file, filename.c_str(), "ab") != 0 || !file) 
+    {
+        throw FileIOException("Cannot open journal for writing: " + filename);
+    }
+    bool written = fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size() &&
+        fflush(file) == 0 && _commit(_fileno(file)) == 0;
+    written = (fclose(file) == 0) && written;
+    if (!written) 
+    {
+        throw FileIOException("Cannot append to journal: " + filename);
+    }
+
+    recordCount += count;
+}
+
+void SaleJournal::append(const Record& record) 
+{
+    std::string frame;
+    appendFrame(record, frame);
+    writeFrames(frame, 1);
+}
+
+void SaleJournal::appendBatch(const std::vector<Record>& records) 
+{
+    if (records.empty()) 
+    {
+        return;
+    }
+
+    std::string frames;
+    for (const auto& record : records) 
+    {
+        appendFrame(record, frames);
+    }
+    writeFrames(frames, records.size());
+}
+
+std::vector<SaleJournal::Record> SaleJournal::load() 
+{
+    std::vector<Record> records;
+    recordCount = 0;
+
+    //         
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) 
+    {
+        return records;
+    }
+    std::string contents(static_cast<size_t>(file.tellg()), '\0');
+    file.seekg(0);
+    if (!contents.empty() && !file.read(&contents[0], contents.size())) 
+    {
+        throw FileIOException("Cannot read journal: " + filename);
+    }
+    file.close();
+
+    BinaryReader frames(contents.data(), contents.data() + contents.size());
+    size_t valid = 0;
+    while (frames.remaining() > 0) 
+    {
+        if (frames.remaining() < sizeof(size_t)) 
+        {
+            logger->log(LogLevel::WARNING, "Torn record at the end of journal " + filename + " ignored");
+            break;
+        }
+
+        size_t length = frames.read<size_t>();
+        if (length > Config::JOURNAL_MAX_RECORD_SIZE) 
+        {
+            logger->log(LogLevel::WARNING, "Corrupted record length in journal " + filename + ", replay stopped");
+            break;
+        }
+
+        if (frames.remaining() < length + sizeof(uint32_t)) 
+        {
+            logger->log(LogLevel::WARNING, "Torn record at the end of journal " + filename + " ignored");
+            break;
+        }
+
+        const char* payload = frames.position();
+        frames.skip(length);
+        uint32_t sum = frames.read<uint32_t>();
+        if (DataFormat::crc32(payload, length) != sum) 
+        {
+            logger->log(LogLevel::WARNING, "Corrupted record in journal " + filename + ", replay stopped");
+            break;
+        }
+
+        BinaryReader in(payload, payload + length);
+        Record record;
+        Schema::read(in, record);
+        records.push_back(record);
+        valid = static_cast<size_t>(frames.position() - contents.data());
+    }
+
+    //   ,            
+    if (valid < contents.size()) 
+    {
+        std::ofstream rewrite(filename, std::ios::binary | std::ios::trunc);
+        rewrite.write(contents.data(), valid);
+        if (!rewrite) 
+        {
+            throw FileIOException("Cannot truncate journal: " + filename);
+        }
+    }
+
+    recordCount = records.size();
+    if (recordCount > 0) 
+    {
+        logger->log(LogLevel::INFO, "Journal loaded from " + filename + ", records: " + std::to_string(recordCount));
+    }
+    return records;
+}
+
+void SaleJournal::clear() 
+{
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) 
+    {
+        throw FileIOException("Cannot truncate journal: " + filename);
+    }
+    recordCount = 0;
+}
+
+size_t SaleJournal::getRecordCount() const 
+{
+    return recordCount;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include "Sale.h"
+#include "Config.h"
+#include "Exceptions.h"
+#include "Logger.h"
+
+//       :     ,
+//    sales.dat  products.dat     .
+class SaleJournal 
+{
+public:
+    struct Record 
+    {
+        Sale sale;
+        std::vector<std::pair<int, int>> keyDecrements;
+
+        static auto fields() 
+        {
+            return std::make_tuple(Schema::field(&Record::sale), Schema::field(&Record::keyDecrements));
+        }
+    };
+
+private:
+    std::string filename;
+    size_t recordCount;
+    Logger* logger;
+
+    static void appendFrame(const Record& record, std::string& buffer);
+    void writeFrames(const std::string& buffer, size_t count);
+
+public:
+    explicit SaleJournal(const std::string& journalFile);
+
+    void append(const Record& record);
+    void appendBatch(const std::vector<Record>& records);
+    std::vector<Record> load();
+    void clear();
+    size_t getRecordCount() const;
+};
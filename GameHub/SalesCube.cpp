@@ -0,0 +1,174 @@
+#include "SalesCube.h"
+
+void SalesCube::Bucket::merge(const Bucket& other) 
+{
+    revenue += other.revenue;
+    discounts += other.discounts;
+    transactions += other.transactions;
+    for (const auto& entry : other.productUnits) 
+    {
+        productUnits[entry.first] += entry.second;
+    }
+}
+
+std::time_t SalesCube::dayStart(std::time_t time) 
+{
+    std::tm tm;
+    localtime_s(&tm, &time);
+    tm.tm_hour = 0;
+    tm.tm_min = 0;
+    tm.tm_sec = 0;
+    tm.tm_isdst = -1;
+    return std::mktime(&tm);
+}
+
+std::time_t SalesCube::nextDayStart(std::time_t dayBegin) 
+{
+    std::tm tm;
+    localtime_s(&tm, &dayBegin);
+    tm.tm_mday += 1;
+    tm.tm_hour = 0;
+    tm.tm_min = 0;
+    tm.tm_sec = 0;
+    tm.tm_isdst = -1;
+    return std::mktime(&tm);
+}
+
+std::time_t SalesCube::hourStart(std::time_t time) 
+{
+    std::tm tm;
+    localtime_s(&tm, &time);
+    tm.tm_min = 0;
+    tm.tm_sec = 0;
+    tm.tm_isdst = -1;
+    return std::mktime(&tm);
+}
+
+void SalesCube::addRow(const SalesTable& table, size_t row, Bucket& bucket) 
+{
+    double total = table.getTotalAmounts()[row];
+    double discount = table.getDiscountAmounts()[row];
+    bucket.revenue += total - discount;
+    bucket.discounts += discount;
+    bucket.transactions++;
+
+    const auto& offsets = table.getItemOffsets();
+    const auto& productIds = table.getItemProductIds();
+    const auto& quantities = table.getItemQuantities();
+    for (size_t k = offsets[row]; k < offsets[row + 1]; ++k) 
+    {
+        bucket.productUnits[productIds[k]] += quantities[k];
+    }
+}
+
+void SalesCube::clear() 
+{
+    dayBuckets.clear();
+    hourBuckets.clear();
+}
+
+size_t SalesCube::memoryUsage() const 
+{
+    const size_t nodeOverhead = 4 * sizeof(void*);
+    size_t total = 0;
+    for (const auto& day : dayBuckets) 
+    {
+        total += sizeof(day) + nodeOverhead + day.second.productUnits.size() * (sizeof(std::pair<const int, int>) + nodeOverhead);
+    }
+    for (const auto& hour : hourBuckets) 
+    {
+        total += sizeof(hour) + nodeOverhead + hour.second.rows.capacity() * sizeof(size_t) +
+            hour.second.totals.productUnits.size() * (sizeof(std::pair<const int, int>) + nodeOverhead);
+    }
+    return total;
+}
+
+void SalesCube::add(const SalesTable& table, size_t row) 
+{
+    std::time_t timestamp = table.getTimestamps()[row];
+    if (timestamp == -1) 
+    {
+        return;
+    }
+
+    addRow(table, row, dayBuckets[dayStart(timestamp)]);
+
+    HourBucket& hour = hourBuckets[hourStart(timestamp)];
+    addRow(table, row, hour.totals);
+    hour.rows.push_back(row);
+}
+
+void SalesCube::collectRows(const SalesTable& table, std::time_t from, std::time_t to, Bucket& result) const 
+{
+    const auto& timestamps = table.getTimestamps();
+    for (auto it = hourBuckets.lower_bound(hourStart(from)); it != hourBuckets.end() && it->first < to; ++it) 
+    {
+        for (size_t row : it->second.rows) 
+        {
+            if (timestamps[row] >= from && timestamps[row] < to) 
+            {
+                addRow(table, row, result);
+            }
+        }
+    }
+}
+
+void SalesCube::collectHours(const SalesTable& table, std::time_t from, std::time_t to, Bucket& result) const 
+{
+    if (from >= to) 
+    {
+        return;
+    }
+
+    std::time_t firstHour = hourStart(from);
+    if (firstHour < from) 
+    {
+        firstHour = hourStart(firstHour + 3600);
+    }
+    std::time_t lastHourEnd = hourStart(to);
+
+    if (firstHour >= lastHourEnd) 
+    {
+        collectRows(table, from, to, result);
+        return;
+    }
+
+    collectRows(table, from, firstHour, result);
+    for (auto it = hourBuckets.lower_bound(firstHour); it != hourBuckets.end() && it->first < lastHourEnd; ++it) 
+    {
+        result.merge(it->second.totals);
+    }
+    collectRows(table, lastHourEnd, to, result);
+}
+
+SalesCube::Bucket SalesCube::collect(const SalesTable& table, std::time_t start, std::time_t end) const 
+{
+    Bucket result;
+    if (end < start) 
+    {
+        return result;
+    }
+
+    //   ,     [start, rangeEnd)
+    std::time_t rangeEnd = end + 1;
+    std::time_t firstDay = dayStart(start);
+    if (firstDay < start) 
+    {
+        firstDay = nextDayStart(firstDay);
+    }
+    std::time_t lastDayEnd = dayStart(rangeEnd);
+
+    if (firstDay >= lastDayEnd) 
+    {
+        collectHours(table, start, rangeEnd, result);
+        return result;
+    }
+
+    collectHours(table, start, firstDay, result);
+    for (auto it = dayBuckets.lower_bound(firstDay); it != dayBuckets.end() && it->first < lastDayEnd; ++it) 
+    {
+        result.merge(it->second);
+    }
+    collectHours(table, lastDayEnd, rangeEnd, result);
+    return result;
+}
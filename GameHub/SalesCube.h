@@ -0,0 +1,48 @@
+#pragma once
+#include <vector>
+#include <map>
+#include <ctime>
+#include "SalesTable.h"
+
+//      .      ,
+//               .
+class SalesCube 
+{
+public:
+    struct Bucket 
+    {
+        double revenue;
+        double discounts;
+        int transactions;
+        std::map<int, int> productUnits;
+
+        Bucket() : revenue(0.0), discounts(0.0), transactions(0) {}
+
+        void merge(const Bucket& other);
+    };
+
+private:
+    struct HourBucket 
+    {
+        Bucket totals;
+        std::vector<size_t> rows;
+    };
+
+    std::map<std::time_t, Bucket> dayBuckets;
+    std::map<std::time_t, HourBucket> hourBuckets;
+
+    static std::time_t dayStart(std::time_t time);
+    static std::time_t nextDayStart(std::time_t dayBegin);
+    static std::time_t hourStart(std::time_t time);
+    static void addRow(const SalesTable& table, size_t row, Bucket& bucket);
+
+    void collectHours(const SalesTable& table, std::time_t from, std::time_t to, Bucket& result) const;
+    void collectRows(const SalesTable& table, std::time_t from, std::time_t to, Bucket& result) const;
+
+public:
+    void clear();
+    //    :         
+    size_t memoryUsage() const;
+    void add(const SalesTable& table, size_t row);
+    Bucket collect(const SalesTable& table, std::time_t start, std::time_t end) const;
+};
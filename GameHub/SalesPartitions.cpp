@@ -0,0 +1,403 @@
+#include "SalesPartitions.h"
+#include "CommitQueue.h"
+#include <map>
+#include <set>
+#include <cstdio>
+#include <algorithm>
+#include <limits>
+#include <fstream>
+
+bool SalesPartition::overlaps(std::time_t start, std::time_t end) const 
+{
+    return minTime <= end && maxTime >= start;
+}
+
+void SalesSegment::add(const Sale& sale) 
+{
+    std::time_t time = static_cast<std::time_t>(sale.getSaleDateTime().getSeconds());
+    if (table.size() == 0 || time < minTime) 
+    {
+        minTime = time;
+    }
+    if (table.size() == 0 || time > maxTime) 
+    {
+        maxTime = time;
+    }
+    table.append(sale);
+    cube.add(table, table.size() - 1);
+}
+
+bool SalesSegment::overlaps(std::time_t start, std::time_t end) const 
+{
+    return table.size() > 0 && minTime <= end && maxTime >= start;
+}
+
+size_t SalesSegment::memoryUsage() const 
+{
+    return table.memoryUsage() + cube.memoryUsage();
+}
+
+SalesPartitions::SalesPartitions(const std::string& manifestFile) : manifestFile(manifestFile) 
+{
+    logger = Logger::getInstance();
+
+    //   sales.dat     :   
+    //     ,         
+    if (!std::ifstream(manifestFile, std::ios::binary).is_open()) 
+    {
+        migrate(Config::SALES_FILE);
+    }
+    else 
+    {
+        try 
+        {
+            partitions = fileManager.readRecords<SalesPartition>(manifestFile);
+        }
+        catch (const std::exception& e) 
+        {
+            logger->log(LogLevel::ERR, "Cannot read " + manifestFile + ": " + e.what() + ", rebuilding it from partition files");
+            rebuild();
+        }
+    }
+    std::sort(partitions.begin(), partitions.end(),
+        [](const SalesPartition& a, const SalesPartition& b) { return a.month < b.month; });
+    fillMaxSaleIds();
+}
+
+int SalesPartitions::monthOf(std::time_t time) 
+{
+    std::tm tm;
+    localtime_s(&tm, &time);
+    return (tm.tm_year + 1900) * 100 + tm.tm_mon + 1;
+}
+
+std::string SalesPartitions::fileNameFor(int month) 
+{
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%04d_%02d", month / 100, month % 100);
+    return Config::SALES_PARTITION_PREFIX + buffer + ".dat";
+}
+
+void SalesPartitions::migrate(const std::string& legacyFile) 
+{
+    auto sales = fileManager.loadFromFile<Sale>(legacyFile);
+    if (sales.empty()) 
+    {
+        return;
+    }
+
+    //        
+    logger->log(LogLevel::INFO, "Moving sales from " + legacyFile + " to monthly partitions, count: " + std::to_string(sales.size()));
+    if (!append(sales)) 
+    {
+        throw FileIOException("Cannot move sales to monthly partitions");
+    }
+}
+
+int SalesPartitions::monthOfFile(const std::string& filename) 
+{
+    int year = 0;
+    int month = 0;
+    if (filename.compare(0, Config::SALES_PARTITION_PREFIX.size(), Config::SALES_PARTITION_PREFIX) != 0 ||
+        std::sscanf(filename.c_str() + Config::SALES_PARTITION_PREFIX.size(), "%4d_%2d", &year, &month) != 2) 
+    {
+        return 0;
+    }
+    int value = year * 100 + month;
+    return fileNameFor(value) == filename ? value : 0;
+}
+
+void SalesPartitions::rebuild() 
+{
+    partitions.clear();
+
+    WIN32_FIND_DATAA found;
+    HANDLE search = FindFirstFileA((Config::SALES_PARTITION_PREFIX + "*.dat").c_str(), &found);
+    if (search != INVALID_HANDLE_VALUE) 
+    {
+        do 
+        {
+            int month = monthOfFile(found.cFileName);
+            if (month == 0) 
+            {
+                continue;
+            }
+
+            SalesPartition& partition = partitionFor(month);
+            for (const auto& sale : fileManager.readRecords<Sale>(partition.filename)) 
+            {
+                int64_t time = sale.getSaleDateTime().getSeconds();
+                partition.minTime = (std::min)(partition.minTime, time);
+                partition.maxTime = (std::max)(partition.maxTime, time);
+                partition.maxSaleId = (std::max)(partition.maxSaleId, sale.getSaleId());
+                partition.saleCount++;
+            }
+        } while (FindNextFileA(search, &found));
+        FindClose(search);
+    }
+
+    int currentMonth = monthOf(std::time(nullptr));
+    for (auto& partition : partitions) 
+    {
+        partition.sealed = partition.month < currentMonth;
+    }
+    if (!saveManifest()) 
+    {
+        throw FileIOException("Cannot rebuild sales partition list: " + manifestFile);
+    }
+    logger->log(LogLevel::INFO, "Sales partition list rebuilt, partitions: " + std::to_string(partitions.size()));
+}
+
+void SalesPartitions::fillMaxSaleIds() 
+{
+    //         :      
+    bool filled = false;
+    for (auto& partition : partitions) 
+    {
+        if (partition.maxSaleId != 0 || partition.saleCount == 0) 
+        {
+            continue;
+        }
+        for (const auto& sale : fileManager.loadFromFile<Sale>(partition.filename)) 
+        {
+            partition.maxSaleId = (std::max)(partition.maxSaleId, sale.getSaleId());
+        }
+        filled = true;
+    }
+    if (filled && !saveManifest()) 
+    {
+        logger->log(LogLevel::WARNING, "Cannot update sales partition list: " + manifestFile);
+    }
+}
+
+const std::vector<SalesPartition>& SalesPartitions::getPartitions() const 
+{
+    return partitions;
+}
+
+const SalesPartition* SalesPartitions::find(int month) const 
+{
+    auto it = std::lower_bound(partitions.begin(), partitions.end(), month,
+        [](const SalesPartition& partition, int value) { return partition.month < value; });
+    return (it != partitions.end() && it->month == month) ? &*it : nullptr;
+}
+
+SalesPartition& SalesPartitions::partitionFor(int month) 
+{
+    auto it = std::lower_bound(partitions.begin(), partitions.end(), month,
+        [](const SalesPartition& partition, int value) { return partition.month < value; });
+    if (it == partitions.end() || it->month != month) 
+    {
+        SalesPartition partition;
+        partition.month = month;
+        partition.filename = fileNameFor(month);
+        //        ,      
+        partition.minTime = (std::numeric_limits<int64_t>::max)();
+        partition.maxTime = (std::numeric_limits<int64_t>::min)();
+        it = partitions.insert(it, partition);
+    }
+    return *it;
+}
+
+std::vector<int> SalesPartitions::overlapping(std::time_t start, std::time_t end) const 
+{
+    std::vector<int> months;
+    for (const auto& partition : partitions) 
+    {
+        if (partition.overlaps(start, end)) 
+        {
+            months.push_back(partition.month);
+        }
+    }
+    return months;
+}
+
+int SalesPartitions::writableMonth(std::time_t time) const 
+{
+    int month = monthOf(time);
+    const SalesPartition* partition = find(month);
+    if (partition && partition->sealed) 
+    {
+        return (std::max)(month, monthOf(std::time(nullptr)));
+    }
+    return month;
+}
+
+size_t SalesPartitions::getSaleCount() const 
+{
+    size_t count = 0;
+    for (const auto& partition : partitions) 
+    {
+        count += static_cast<size_t>(partition.saleCount);
+    }
+    return count;
+}
+
+int SalesPartitions::getMaxSaleId() const 
+{
+    int maxSaleId = 0;
+    for (const auto& partition : partitions) 
+    {
+        maxSaleId = (std::max)(maxSaleId, partition.maxSaleId);
+    }
+    return maxSaleId;
+}
+
+std::map<int, int> SalesPartitions::readMaxSaleIds() 
+{
+    //    ,    
+    std::map<int, int> maxSaleIds;
+    for (const auto& partition : partitions) 
+    {
+        int& maxSaleId = maxSaleIds[partition.month];
+        if (partition.sealed) 
+        {
+            maxSaleId = partition.maxSaleId;
+            continue;
+        }
+
+        SaleFileView view(partition.filename);
+        if (view.empty()) 
+        {
+            for (const auto& sale : fileManager.loadFromFile<Sale>(partition.filename)) 
+            {
+                maxSaleId = (std::max)(maxSaleId, sale.getSaleId());
+            }
+            continue;
+        }
+        for (size_t i = 0; i < view.size(); ++i) 
+        {
+            maxSaleId = (std::max)(maxSaleId, view[i].getSaleId());
+        }
+    }
+    return maxSaleIds;
+}
+
+std::vector<Sale> SalesPartitions::load(int month) 
+{
+    const SalesPartition* partition = find(month);
+    if (!partition) 
+    {
+        return std::vector<Sale>();
+    }
+    return fileManager.loadFromFile<Sale>(partition->filename);
+}
+
+std::vector<Sale> SalesPartitions::loadAll() 
+{
+    std::vector<Sale> sales;
+    for (auto& partition : partitions) 
+    {
+        auto part = fileManager.loadFromFile<Sale>(partition.filename);
+        partition.saleCount = part.size();
+        sales.insert(sales.end(), part.begin(), part.end());
+    }
+    return sales;
+}
+
+std::vector<Sale> SalesPartitions::loadCustomer(int customerId) 
+{
+    std::vector<Sale> sales;
+    for (const auto& partition : partitions) 
+    {
+        if (partition.saleCount == 0) 
+        {
+            continue;
+        }
+
+        SaleFileView view(partition.filename);
+        if (view.empty()) 
+        {
+            // ,     ,   
+            for (const auto& sale : fileManager.loadFromFile<Sale>(partition.filename)) 
+            {
+                if (sale.getCustomerId() == customerId) 
+                {
+                    sales.push_back(sale);
+                }
+            }
+            continue;
+        }
+
+        for (size_t i = 0; i < view.size(); ++i) 
+        {
+            SaleView sale = view[i];
+            if (sale.getCustomerId() == customerId) 
+            {
+                sales.push_back(sale.materialize());
+            }
+        }
+    }
+    return sales;
+}
+
+bool SalesPartitions::saveManifest() 
+{
+    //        ,    
+    return fileManager.saveToFile(manifestFile, partitions) && CommitQueue::getInstance()->flush(manifestFile);
+}
+
+bool SalesPartitions::append(std::vector<Sale>& sales) 
+{
+    if (sales.empty()) 
+    {
+        return true;
+    }
+
+    //         :    
+    std::map<int, std::vector<Sale>> batches;
+    for (const auto& sale : sales) 
+    {
+        std::time_t time = static_cast<std::time_t>(sale.getSaleDateTime().getSeconds());
+        int month = writableMonth(time);
+        SalesPartition& partition = partitionFor(month);
+        partition.minTime = (std::min)(partition.minTime, static_cast<int64_t>(time));
+        partition.maxTime = (std::max)(partition.maxTime, static_cast<int64_t>(time));
+        partition.maxSaleId = (std::max)(partition.maxSaleId, sale.getSaleId());
+        batches[month].push_back(sale);
+    }
+
+    //      :     
+    //    ,        
+    if (!saveManifest()) 
+    {
+        return false;
+    }
+
+    //    :   ,      ,
+    //        
+    std::set<int> written;
+    bool appended = true;
+    for (const auto& batch : batches) 
+    {
+        SalesPartition& partition = partitionFor(batch.first);
+        if (!fileManager.appendToFile(partition.filename, batch.second, true)) 
+        {
+            appended = false;
+            break;
+        }
+        partition.saleCount += batch.second.size();
+        for (const auto& sale : batch.second) 
+        {
+            written.insert(sale.getSaleId());
+        }
+    }
+    sales.erase(std::remove_if(sales.begin(), sales.end(),
+        [&written](const Sale& sale) { return written.count(sale.getSaleId()) > 0; }), sales.end());
+    if (!appended) 
+    {
+        saveManifest();
+        return false;
+    }
+
+    int currentMonth = monthOf(std::time(nullptr));
+    for (auto& partition : partitions) 
+    {
+        if (!partition.sealed && partition.month < currentMonth) 
+        {
+            partition.sealed = true;
+            logger->log(LogLevel::INFO, "Sales partition sealed: " + partition.filename);
+        }
+    }
+    return saveManifest();
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <map>
+#include <ctime>
+#include <cstdint>
+#include "Config.h"
+#include "Sale.h"
+#include "Schema.h"
+#include "SalesTable.h"
+#include "SalesCube.h"
+#include "SaleFileView.h"
+#include "FileManager.h"
+#include "Logger.h"
+
+//     .      ,
+//     ,    .
+struct SalesPartition 
+{
+    int month;
+    std::string filename;
+    int64_t minTime;
+    int64_t maxTime;
+    uint64_t saleCount;
+    bool sealed;
+    int maxSaleId;
+
+    SalesPartition() : month(0), minTime(0), maxTime(0), saleCount(0), sealed(false), maxSaleId(0) {}
+
+    static auto fields() 
+    {
+        return std::make_tuple(
+            Schema::field(&SalesPartition::month), Schema::field(&SalesPartition::filename),
+            Schema::field(&SalesPartition::minTime), Schema::field(&SalesPartition::maxTime),
+            Schema::field(&SalesPartition::saleCount), Schema::field(&SalesPartition::sealed),
+            Schema::field<2>(&SalesPartition::maxSaleId));
+    }
+
+    bool overlaps(std::time_t start, std::time_t end) const;
+};
+
+//    ,   
+struct SalesSegment 
+{
+    SalesTable table;
+    SalesCube cube;
+    std::time_t minTime;
+    std::time_t maxTime;
+    //   ,          
+    uint64_t lastUsed;
+
+    SalesSegment() : minTime(0), maxTime(0), lastUsed(0) {}
+
+    void add(const Sale& sale);
+    bool overlaps(std::time_t start, std::time_t end) const;
+    size_t memoryUsage() const;
+};
+
+// ,   :     ,     
+//  .       ,   .
+class SalesPartitions 
+{
+private:
+    std::string manifestFile;
+    std::vector<SalesPartition> partitions;
+    FileManager fileManager;
+    Logger* logger;
+
+    SalesPartition& partitionFor(int month);
+    void migrate(const std::string& legacyFile);
+    void rebuild();
+    void fillMaxSaleIds();
+    bool saveManifest();
+
+public:
+    explicit SalesPartitions(const std::string& manifestFile);
+
+    //     * 100 +    
+    static int monthOf(std::time_t time);
+    static std::string fileNameFor(int month);
+    //     ; 0,     
+    static int monthOfFile(const std::string& filename);
+
+    const std::vector<SalesPartition>& getPartitions() const;
+    const SalesPartition* find(int month) const;
+    std::vector<int> overlapping(std::time_t start, std::time_t end) const;
+    // ,         
+    int writableMonth(std::time_t time) const;
+    size_t getSaleCount() const;
+    //    :       
+    int getMaxSaleId() const;
+    //       :       
+    std::map<int, int> readMaxSaleIds();
+
+    std::vector<Sale> load(int month);
+    std::vector<Sale> loadAll();
+    //   :      ,      
+    std::vector<Sale> loadCustomer(int customerId);
+    //     ;          
+    bool append(std::vector<Sale>& sales);
+};
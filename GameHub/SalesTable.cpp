@@ -0,0 +1,63 @@
+#include "SalesTable.h"
+
+SalesTable::SalesTable() 
+{
+    itemOffsets.push_back(0);
+}
+
+void SalesTable::clear() 
+{
+    timestamps.clear();
+    customerIds.clear();
+    totalAmounts.clear();
+    discountAmounts.clear();
+    itemOffsets.assign(1, 0);
+    itemProductIds.clear();
+    itemQuantities.clear();
+}
+
+void SalesTable::reserve(size_t salesCount) 
+{
+    timestamps.reserve(salesCount);
+    customerIds.reserve(salesCount);
+    totalAmounts.reserve(salesCount);
+    discountAmounts.reserve(salesCount);
+    itemOffsets.reserve(salesCount + 1);
+}
+
+void SalesTable::append(const Sale& sale) 
+{
+    Timestamp saleTime = sale.getSaleDateTime();
+    timestamps.push_back(saleTime.isSet() ? static_cast<std::time_t>(saleTime.getSeconds()) : -1);
+    customerIds.push_back(sale.getCustomerId());
+    totalAmounts.push_back(sale.getTotalAmount());
+    discountAmounts.push_back(sale.getDiscountAmount());
+
+    for (const auto& item : sale.getItems()) 
+    {
+        itemProductIds.push_back(item.first);
+        itemQuantities.push_back(item.second);
+    }
+    itemOffsets.push_back(itemProductIds.size());
+}
+
+size_t SalesTable::size() const 
+{
+    return timestamps.size();
+}
+
+size_t SalesTable::memoryUsage() const 
+{
+    return timestamps.capacity() * sizeof(std::time_t) + customerIds.capacity() * sizeof(int) +
+        totalAmounts.capacity() * sizeof(double) + discountAmounts.capacity() * sizeof(double) +
+        itemOffsets.capacity() * sizeof(size_t) + itemProductIds.capacity() * sizeof(int) +
+        itemQuantities.capacity() * sizeof(int);
+}
+
+const std::vector<std::time_t>& SalesTable::getTimestamps() const { return timestamps; }
+const std::vector<int>& SalesTable::getCustomerIds() const { return customerIds; }
+const std::vector<double>& SalesTable::getTotalAmounts() const { return totalAmounts; }
+const std::vector<double>& SalesTable::getDiscountAmounts() const { return discountAmounts; }
+const std::vector<size_t>& SalesTable::getItemOffsets() const { return itemOffsets; }
+const std::vector<int>& SalesTable::getItemProductIds() const { return itemProductIds; }
+const std::vector<int>& SalesTable::getItemQuantities() const { return itemQuantities; }
@@ -0,0 +1,38 @@
+#pragma once
+#include <vector>
+#include <ctime>
+#include "Sale.h"
+#include "Config.h"
+
+//     :    
+//    ,    i   [itemOffsets[i], itemOffsets[i + 1]).
+class SalesTable 
+{
+private:
+    std::vector<std::time_t> timestamps;
+    std::vector<int> customerIds;
+    std::vector<double> totalAmounts;
+    std::vector<double> discountAmounts;
+
+    std::vector<size_t> itemOffsets;
+    std::vector<int> itemProductIds;
+    std::vector<int> itemQuantities;
+
+public:
+    SalesTable();
+
+    void clear();
+    void reserve(size_t salesCount);
+    void append(const Sale& sale);
+    size_t size() const;
+    //      
+    size_t memoryUsage() const;
+
+    const std::vector<std::time_t>& getTimestamps() const;
+    const std::vector<int>& getCustomerIds() const;
+    const std::vector<double>& getTotalAmounts() const;
+    const std::vector<double>& getDiscountAmounts() const;
+    const std::vector<size_t>& getItemOffsets() const;
+    const std::vector<int>& getItemProductIds() const;
+    const std::vector<int>& getItemQuantities() const;
+};
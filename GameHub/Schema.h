@@ -0,0 +1,410 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <cstdint>
+#include <type_traits>
+#include <memory>
+#include "BinaryCodec.h"
+#include "Timestamp.h"
+#include "Exceptions.h"
+
+//      .      
+//    fields()   ,  ,   
+//      .
+//
+//       :    
+// Schema::field<N>(...),  N -  .    ,  
+// ,           
+//    .        
+// Schema::field<Since, Until>(...):      [Since, Until)    .
+namespace Schema 
+{
+    const uint16_t BASE_REVISION = 1;
+
+    //    fields():   Schema::Access 
+    struct Access 
+    {
+        template<typename T>
+        static auto fields() -> decltype(T::fields()) 
+        {
+            return T::fields();
+        }
+    };
+
+    template<typename T>
+    using FieldList = decltype(Access::fields<T>());
+
+    template<typename... Ts>
+    struct MakeVoid 
+    {
+        typedef void type;
+    };
+
+    //   .      
+    template<typename T, typename = void>
+    struct Codec 
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "No Schema::Codec for this field type");
+
+        static size_t size(const T&) { return sizeof(T); }
+        static void encode(BinaryWriter& out, const T& value) { out.write(value); }
+        static void decode(BinaryReader& in, T& value, uint16_t) { in.read(value); }
+    };
+
+    template<>
+    struct Codec<std::string> 
+    {
+        static size_t size(const std::string& value) { return sizeof(size_t) + value.size(); }
+        static void encode(BinaryWriter& out, const std::string& value) { out.writeString(value); }
+        static void decode(BinaryReader& in, std::string& value, uint16_t) { in.readString(value); }
+    };
+
+    template<>
+    struct Codec<std::vector<std::string>> 
+    {
+        static size_t size(const std::vector<std::string>& values) 
+        {
+            size_t total = sizeof(size_t);
+            for (const auto& value : values) 
+            {
+                total += sizeof(size_t) + value.size();
+            }
+            return total;
+        }
+        static void encode(BinaryWriter& out, const std::vector<std::string>& values) { out.writeStringList(values); }
+        static void decode(BinaryReader& in, std::vector<std::string>& values, uint16_t) { in.readStringList(values); }
+    };
+
+    template<>
+    struct Codec<std::vector<std::pair<int, int>>> 
+    {
+        static size_t size(const std::vector<std::pair<int, int>>& values) 
+        {
+            return sizeof(size_t) + values.size() * 2 * sizeof(int);
+        }
+
+        static void encode(BinaryWriter& out, const std::vector<std::pair<int, int>>& values) 
+        {
+            out.write(values.size());
+            for (const auto& value : values) 
+            {
+                out.write(value.first);
+                out.write(value.second);
+            }
+        }
+
+        static void decode(BinaryReader& in, std::vector<std::pair<int, int>>& values, uint16_t) 
+        {
+            size_t count = in.read<size_t>();
+            if (count > in.remaining() / (2 * sizeof(int))) 
+            {
+                throw FileIOException("Record field extends beyond record bounds");
+            }
+            values.resize(count);
+            for (auto& value : values) 
+            {
+                in.read(value.first);
+                in.read(value.second);
+            }
+        }
+    };
+
+    //       
+    template<typename T>
+    struct Codec<std::vector<T>, typename std::enable_if<std::is_trivially_copyable<T>::value>::type> 
+    {
+        static size_t size(const std::vector<T>& values) { return sizeof(size_t) + values.size() * sizeof(T); }
+
+        static void encode(BinaryWriter& out, const std::vector<T>& values) 
+        {
+            out.write(values.size());
+            if (!values.empty()) 
+            {
+                out.writeBytes(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+            }
+        }
+
+        static void decode(BinaryReader& in, std::vector<T>& values, uint16_t) 
+        {
+            size_t count = in.read<size_t>();
+            if (count > in.remaining() / sizeof(T)) 
+            {
+                throw FileIOException("Record field extends beyond record bounds");
+            }
+            values.resize(count);
+            for (auto& value : values) 
+            {
+                in.read(value);
+            }
+        }
+    };
+
+    // Timestamp       
+    template<>
+    struct Codec<Timestamp> 
+    {
+        static size_t size(const Timestamp&) { return sizeof(size_t) + sizeof(int64_t); }
+        static void encode(BinaryWriter& out, const Timestamp& value) { value.serialize(out); }
+        static void decode(BinaryReader& in, Timestamp& value, uint16_t) { value.deserialize(in); }
+    };
+
+    template<typename T>
+    struct Codec<T, typename MakeVoid<FieldList<T>>::type>;
+
+    const uint16_t CURRENT = 0;
+
+    template<uint16_t Since, uint16_t Until>
+    struct Range 
+    {
+        static constexpr uint16_t since = Since;
+        static constexpr uint16_t until = Until;
+        static constexpr uint16_t last = Until > Since ? Until : Since;
+
+        static bool presentIn(uint16_t fileRevision) 
+        {
+            return Since <= fileRevision && (Until == CURRENT || fileRevision < Until);
+        }
+        static constexpr bool written() { return Until == CURRENT; }
+    };
+
+    //         . 
+    //    ,    
+    template<typename Stored, typename T>
+    struct Convert;
+
+    //    : Derived    , Stored -    
+    template<typename Derived, uint16_t Since, uint16_t Until, typename T, typename Stored>
+    struct Descriptor : Range<Since, Until> 
+    {
+        typedef Stored Type;
+        typedef std::is_same<T, Stored> Direct;
+        static_assert(Direct::value || Until != CURRENT, "A converted field can only be read from old revisions");
+
+        template<typename Object>
+        size_t encodedSize(const Object& object) const 
+        {
+            return Range<Since, Until>::written() ? sizeOf(object, Direct()) : 0;
+        }
+
+        template<typename Object>
+        void encode(BinaryWriter& out, const Object& object) const 
+        {
+            if (Range<Since, Until>::written()) 
+            {
+                encodeAs(out, object, Direct());
+            }
+        }
+
+        template<typename Object>
+        void decode(BinaryReader& in, Object& object, uint16_t fileRevision) const 
+        {
+            if (Range<Since, Until>::presentIn(fileRevision)) 
+            {
+                decodeAs(in, object, fileRevision, Direct());
+            }
+        }
+
+    private:
+        const Derived& self() const { return static_cast<const Derived&>(*this); }
+
+        template<typename Object>
+        size_t sizeOf(const Object& object, std::true_type) const { return Codec<T>::size(self().get(object)); }
+        template<typename Object>
+        size_t sizeOf(const Object&, std::false_type) const { return 0; }
+
+        template<typename Object>
+        void encodeAs(BinaryWriter& out, const Object& object, std::true_type) const { Codec<T>::encode(out, self().get(object)); }
+        template<typename Object>
+        void encodeAs(BinaryWriter&, const Object&, std::false_type) const {}
+
+        template<typename Object>
+        void decodeAs(BinaryReader& in, Object& object, uint16_t fileRevision, std::true_type) const 
+        {
+            Codec<T>::decode(in, self().access(object), fileRevision);
+        }
+
+        template<typename Object>
+        void decodeAs(BinaryReader& in, Object& object, uint16_t fileRevision, std::false_type) const 
+        {
+            Stored stored;
+            Codec<Stored>::decode(in, stored, fileRevision);
+            Convert<Stored, T>::apply(stored, self().access(object));
+        }
+    };
+
+    template<uint16_t Since, uint16_t Until, typename Owner, typename T, typename Stored = T>
+    struct Field : Descriptor<Field<Since, Until, Owner, T, Stored>, Since, Until, T, Stored> 
+    {
+        T Owner::* member;
+
+        explicit Field(T Owner::* fieldMember) : member(fieldMember) {}
+
+        template<typename Object>
+        const T& get(const Object& object) const { return object.*member; }
+        template<typename Object>
+        T& access(Object& object) const { return object.*member; }
+    };
+
+    //  ,      shared_ptr.     
+    template<uint16_t Since, uint16_t Until, typename Owner, typename Held, typename T, typename Stored = T>
+    struct HeldField : Descriptor<HeldField<Since, Until, Owner, Held, T, Stored>, Since, Until, T, Stored> 
+    {
+        std::shared_ptr<Held> Owner::* holder;
+        T Held::* member;
+
+        HeldField(std::shared_ptr<Held> Owner::* fieldHolder, T Held::* fieldMember) : holder(fieldHolder), member(fieldMember) {}
+
+        template<typename Object>
+        const T& get(const Object& object) const 
+        {
+            static const T empty{};
+            const auto& held = object.*holder;
+            return held ? (*held).*member : empty;
+        }
+
+        template<typename Object>
+        T& access(Object& object) const 
+        {
+            auto& held = object.*holder;
+            if (!held) 
+            {
+                held = std::make_shared<Held>();
+            }
+            return (*held).*member;
+        }
+    };
+
+    template<uint16_t Since = BASE_REVISION, uint16_t Until = CURRENT, typename Owner, typename T>
+    Field<Since, Until, Owner, T> field(T Owner::* member) 
+    {
+        return Field<Since, Until, Owner, T>(member);
+    }
+
+    template<uint16_t Since = BASE_REVISION, uint16_t Until = CURRENT, typename Owner, typename Held, typename T>
+    HeldField<Since, Until, Owner, Held, T> field(std::shared_ptr<Held> Owner::* holder, T Held::* member) 
+    {
+        return HeldField<Since, Until, Owner, Held, T>(holder, member);
+    }
+
+    // ,    [Since, Until)   Stored       
+    template<uint16_t Since, uint16_t Until, typename Stored, typename Owner, typename T>
+    Field<Since, Until, Owner, T, Stored> converted(T Owner::* member) 
+    {
+        return Field<Since, Until, Owner, T, Stored>(member);
+    }
+
+    template<uint16_t Since, uint16_t Until, typename Stored, typename Owner, typename Held, typename T>
+    HeldField<Since, Until, Owner, Held, T, Stored> converted(std::shared_ptr<Held> Owner::* holder, T Held::* member) 
+    {
+        return HeldField<Since, Until, Owner, Held, T, Stored>(holder, member);
+    }
+
+
+    //    -    ,   
+    template<typename T, typename = void>
+    struct Revision 
+    {
+        static constexpr uint16_t value = 0;
+    };
+
+    template<typename... Fields>
+    struct MaxRevision;
+
+    template<>
+    struct MaxRevision<> 
+    {
+        static constexpr uint16_t value = BASE_REVISION;
+    };
+
+    template<typename First, typename... Rest>
+    struct MaxRevision<First, Rest...> 
+    {
+        static constexpr uint16_t nested = Revision<typename First::Type>::value;
+        static constexpr uint16_t own = First::last > nested ? First::last : nested;
+        static constexpr uint16_t value = own > MaxRevision<Rest...>::value ? own : MaxRevision<Rest...>::value;
+    };
+
+    template<typename... Fields>
+    struct MaxRevision<std::tuple<Fields...>> : MaxRevision<Fields...> {};
+
+    template<typename T>
+    struct Revision<T, typename MakeVoid<FieldList<T>>::type> 
+    {
+        static constexpr uint16_t value = MaxRevision<FieldList<T>>::value;
+    };
+
+    template<typename T>
+    constexpr uint16_t revision() 
+    {
+        return Revision<T>::value;
+    }
+
+    template<typename Object, typename Tuple, size_t... I>
+    size_t fieldsSize(const Object& object, const Tuple& fields, std::index_sequence<I...>) 
+    {
+        size_t total = 0;
+        int expand[] = { 0, (total += std::get<I>(fields).encodedSize(object), 0)... };
+        (void)expand;
+        return total;
+    }
+
+    template<typename Object, typename Tuple, size_t... I>
+    void encodeFields(BinaryWriter& out, const Object& object, const Tuple& fields, std::index_sequence<I...>) 
+    {
+        int expand[] = { 0, (std::get<I>(fields).encode(out, object), 0)... };
+        (void)expand;
+    }
+
+    template<typename Object, typename Tuple, size_t... I>
+    void decodeFields(BinaryReader& in, Object& object, const Tuple& fields, uint16_t fileRevision, std::index_sequence<I...>) 
+    {
+        int expand[] = { 0, (std::get<I>(fields).decode(in, object, fileRevision), 0)... };
+        (void)expand;
+    }
+
+    template<typename T>
+    size_t encodedSize(const T& object) 
+    {
+        const auto fields = Access::fields<T>();
+        return fieldsSize(object, fields, std::make_index_sequence<std::tuple_size<FieldList<T>>::value>());
+    }
+
+    template<typename T>
+    void encode(BinaryWriter& out, const T& object) 
+    {
+        const auto fields = Access::fields<T>();
+        encodeFields(out, object, fields, std::make_index_sequence<std::tuple_size<FieldList<T>>::value>());
+    }
+
+    template<typename T>
+    void decode(BinaryReader& in, T& object, uint16_t fileRevision) 
+    {
+        const auto fields = Access::fields<T>();
+        decodeFields(in, object, fields, fileRevision, std::make_index_sequence<std::tuple_size<FieldList<T>>::value>());
+    }
+
+    //      
+    template<typename T>
+    struct Codec<T, typename MakeVoid<FieldList<T>>::type> 
+    {
+        static size_t size(const T& value) { return encodedSize(value); }
+        static void encode(BinaryWriter& out, const T& value) { Schema::encode(out, value); }
+        static void decode(BinaryReader& in, T& value, uint16_t fileRevision) { Schema::decode(in, value, fileRevision); }
+    };
+
+    //   :   ,    
+    template<typename T>
+    void write(BinaryWriter& out, const T& object) 
+    {
+        out.reserve(out.size() + encodedSize(object));
+        encode(out, object);
+    }
+
+    template<typename T>
+    void read(BinaryReader& in, T& object, uint16_t fileRevision = revision<T>()) 
+    {
+        decode(in, object, fileRevision);
+    }
+}
@@ -0,0 +1,255 @@
+#include "SearchIndex.h"
+#include <algorithm>
+#include <cstring>
+
+namespace 
+{
+    struct LowerCaseTable 
+    {
+        unsigned char map[256];
+
+        LowerCaseTable() 
+        {
+            for (int c = 0; c < 256; ++c) 
+            {
+                map[c] = static_cast<unsigned char>(c);
+            }
+            for (int c = 'A'; c <= 'Z'; ++c) 
+            {
+                map[c] = static_cast<unsigned char>(c + ('a' - 'A'));
+            }
+
+            //   CP1251: .. (0xC0..0xDF) -> .. (0xE0..0xFF)
+            for (int c = 0xC0; c <= 0xDF; ++c) 
+            {
+                map[c] = static_cast<unsigned char>(c + 0x20);
+            }
+
+            //   ,    
+            const unsigned char pairs[][2] = {
+                { 0x80, 0x90 }, { 0x81, 0x83 }, { 0x8A, 0x9A }, { 0x8C, 0x9C },
+                { 0x8D, 0x9D }, { 0x8E, 0x9E }, { 0x8F, 0x9F }, { 0xA1, 0xA2 },
+                { 0xA3, 0xBC }, { 0xA5, 0xB4 }, { 0xAA, 0xBA }, { 0xAF, 0xBF },
+                { 0xB2, 0xB3 }, { 0xBD, 0xBE }
+            };
+            for (const auto& pair : pairs) 
+            {
+                map[pair[0]] = pair[1];
+            }
+
+            //      ""
+            map[0xA8] = 0xE5;
+            map[0xB8] = 0xE5;
+        }
+    };
+}
+
+std::string SearchIndex::normalize(const std::string& text) 
+{
+    static const LowerCaseTable table;
+
+    std::string result(text.size(), '\0');
+    for (size_t i = 0; i < text.size(); ++i) 
+    {
+        result[i] = static_cast<char>(table.map[static_cast<unsigned char>(text[i])]);
+    }
+    return result;
+}
+
+uint32_t SearchIndex::trigramKey(const std::string& text, size_t pos) 
+{
+    return (static_cast<uint32_t>(static_cast<unsigned char>(text[pos])) << 16) |
+        (static_cast<uint32_t>(static_cast<unsigned char>(text[pos + 1])) << 8) |
+        static_cast<uint32_t>(static_cast<unsigned char>(text[pos + 2]));
+}
+
+std::vector<uint32_t> SearchIndex::trigrams(const std::string& text) 
+{
+    std::vector<uint32_t> keys;
+    if (text.size() < 3) 
+    {
+        return keys;
+    }
+
+    keys.reserve(text.size() - 2);
+    for (size_t i = 0; i + 2 < text.size(); ++i) 
+    {
+        keys.push_back(trigramKey(text, i));
+    }
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    return keys;
+}
+
+void SearchIndex::insertSorted(std::vector<int>& list, int productId) 
+{
+    if (list.empty() || list.back() < productId) 
+    {
+        list.push_back(productId);
+        return;
+    }
+
+    auto it = std::lower_bound(list.begin(), list.end(), productId);
+    if (it == list.end() || *it != productId) 
+    {
+        list.insert(it, productId);
+    }
+}
+
+void SearchIndex::clear() 
+{
+    postings.clear();
+    normalizedTitles.clear();
+}
+
+void SearchIndex::addProduct(int productId, const std::string& title) 
+{
+    removeProduct(productId);
+
+    std::string normalized = normalize(title);
+    for (uint32_t key : trigrams(normalized)) 
+    {
+        insertSorted(postings[key], productId);
+    }
+    normalizedTitles[productId] = normalized;
+}
+
+void SearchIndex::removeProduct(int productId) 
+{
+    auto titleIt = normalizedTitles.find(productId);
+    if (titleIt == normalizedTitles.end()) 
+    {
+        return;
+    }
+
+    for (uint32_t key : trigrams(titleIt->second)) 
+    {
+        auto postingIt = postings.find(key);
+        if (postingIt == postings.end()) 
+        {
+            continue;
+        }
+
+        std::vector<int>& list = postingIt->second;
+        auto it = std::lower_bound(list.begin(), list.end(), productId);
+        if (it != list.end() && *it == productId) 
+        {
+            list.erase(it);
+        }
+        if (list.empty()) 
+        {
+            postings.erase(postingIt);
+        }
+    }
+    normalizedTitles.erase(titleIt);
+}
+
+std::vector<int> SearchIndex::search(const std::string& query) const 
+{
+    std::vector<int> results;
+    std::string normalizedQuery = normalize(query);
+
+    //         -    
+    if (normalizedQuery.size() < 3) 
+    {
+        for (const auto& entry : normalizedTitles) 
+        {
+            if (entry.second.find(normalizedQuery) != std::string::npos) 
+            {
+                results.push_back(entry.first);
+            }
+        }
+        std::sort(results.begin(), results.end());
+        return results;
+    }
+
+    std::vector<const std::vector<int>*> lists;
+    for (uint32_t key : trigrams(normalizedQuery)) 
+    {
+        auto it = postings.find(key);
+        if (it == postings.end()) 
+        {
+            return results;
+        }
+        lists.push_back(&it->second);
+    }
+
+    std::sort(lists.begin(), lists.end(),
+        [](const std::vector<int>* a, const std::vector<int>* b) 
+        {
+            return a->size() < b->size();
+        });
+
+    std::vector<int> candidates = *lists[0];
+    for (size_t i = 1; i < lists.size() && !candidates.empty(); ++i) 
+    {
+        std::vector<int> intersection;
+        intersection.reserve(candidates.size());
+        std::set_intersection(candidates.begin(), candidates.end(),
+            lists[i]->begin(), lists[i]->end(), std::back_inserter(intersection));
+        candidates.swap(intersection);
+    }
+
+    //        ,   
+    for (int productId : candidates) 
+    {
+        if (normalizedTitles.at(productId).find(normalizedQuery) != std::string::npos) 
+        {
+            results.push_back(productId);
+        }
+    }
+    return results;
+}
+
+size_t SearchIndex::size() const 
+{
+    return normalizedTitles.size();
+}
+
+void SearchIndex::write(BinaryWriter& writer) const 
+{
+    writer.write<uint64_t>(postings.size());
+    for (const auto& posting : postings) 
+    {
+        writer.write(posting.first);
+        writer.write<uint64_t>(posting.second.size());
+        writer.writeBytes(reinterpret_cast<const char*>(posting.second.data()), posting.second.size() * sizeof(int));
+    }
+
+    writer.write<uint64_t>(normalizedTitles.size());
+    for (const auto& title : normalizedTitles) 
+    {
+        writer.write(title.first);
+        writer.writeString(title.second);
+    }
+}
+
+void SearchIndex::read(BinaryReader& reader) 
+{
+    clear();
+
+    //      ,      
+    uint64_t postingCount = reader.read<uint64_t>();
+    postings.reserve(static_cast<size_t>((std::min)(postingCount, static_cast<uint64_t>(reader.remaining()))));
+    for (uint64_t i = 0; i < postingCount; ++i) 
+    {
+        uint32_t key = reader.read<uint32_t>();
+        uint64_t count = reader.read<uint64_t>();
+        if (count > reader.remaining() / sizeof(int)) 
+        {
+            throw FileIOException("Search index posting list extends beyond file bounds");
+        }
+        std::vector<int>& list = postings[key];
+        list.resize(static_cast<size_t>(count));
+        std::memcpy(list.data(), reader.position(), list.size() * sizeof(int));
+        reader.skip(list.size() * sizeof(int));
+    }
+
+    uint64_t titleCount = reader.read<uint64_t>();
+    normalizedTitles.reserve(static_cast<size_t>((std::min)(titleCount, static_cast<uint64_t>(reader.remaining()))));
+    for (uint64_t i = 0; i < titleCount; ++i) 
+    {
+        int productId = reader.read<int>();
+        reader.readString(normalizedTitles[productId]);
+    }
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include "BinaryCodec.h"
+
+//       .
+//   CP1251:     , ""  "".
+class SearchIndex 
+{
+private:
+    std::unordered_map<uint32_t, std::vector<int>> postings;
+    std::unordered_map<int, std::string> normalizedTitles;
+
+    static uint32_t trigramKey(const std::string& text, size_t pos);
+    static std::vector<uint32_t> trigrams(const std::string& text);
+    static void insertSorted(std::vector<int>& list, int productId);
+
+public:
+    static std::string normalize(const std::string& text);
+
+    void clear();
+    void addProduct(int productId, const std::string& title);
+    void removeProduct(int productId);
+    std::vector<int> search(const std::string& query) const;
+
+    size_t size() const;
+    void write(BinaryWriter& writer) const;
+    void read(BinaryReader& reader);
+};
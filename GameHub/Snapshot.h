@@ -0,0 +1,26 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+
+//   Store     .
+//     Store:     .
+template<typename T>
+class Snapshot 
+{
+private:
+    const T* first;
+    size_t count;
+    unsigned long version;
+
+public:
+    Snapshot(const std::vector<T>& data, unsigned long dataVersion)
+        : first(data.data()), count(data.size()), version(dataVersion) {
+    }
+
+    const T* begin() const { return first; }
+    const T* end() const { return first + count; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const T& operator[](size_t index) const { return first[index]; }
+    unsigned long getVersion() const { return version; }
+};
@@ -0,0 +1,123 @@
+#include "StartupLoader.h"
+#include <atomic>
+#include <exception>
+#include <sstream>
+#include <iomanip>
+
+StartupLoader::StartupLoader() 
+{
+    logger = Logger::getInstance();
+}
+
+StartupData StartupLoader::load() 
+{
+    StartupData data;
+
+    //    ,        
+    std::vector<Task> tasks = 
+    {
+        { Config::PRODUCTS_FILE, [&]() 
+            {
+                data.store.productsStamp = IndexFile::stampOf(Config::PRODUCTS_FILE);
+                data.store.products = fileManager.loadFromFile<std::shared_ptr<Product>>(Config::PRODUCTS_FILE);
+                return data.store.products.size();
+            } },
+        { Config::PRODUCT_DETAILS_FILE, [&]() 
+            {
+                data.store.productDetails = std::make_shared<ProductDetailsStore>(Config::PRODUCT_DETAILS_FILE);
+                return data.store.productDetails->size();
+            } },
+        { Config::USERS_FILE, [&]() 
+            {
+                data.users = fileManager.loadFromFile<std::shared_ptr<User>>(Config::USERS_FILE);
+                return data.users.size();
+            } },
+        { Config::WISHLISTS_FILE, [&]() 
+            {
+                data.wishlistItems = fileManager.loadFromFile<Wishlist::WishlistItem>(Config::WISHLISTS_FILE);
+                return data.wishlistItems.size();
+            } },
+        { Config::DISCOUNTS_FILE, [&]() 
+            {
+                data.store.discounts = fileManager.loadFromFile<Discount>(Config::DISCOUNTS_FILE);
+                return data.store.discounts.size();
+            } },
+        { Config::SALES_PARTITIONS_FILE, [&]() 
+            {
+                //   :        
+                data.store.salesPartitions = std::make_shared<SalesPartitions>(Config::SALES_PARTITIONS_FILE);
+                return data.store.salesPartitions->getSaleCount();
+            } },
+        { Config::DICTIONARY_FILE, []() 
+            {
+                return StringDictionary::getInstance()->size();
+            } }
+    };
+
+    auto started = std::chrono::steady_clock::now();
+    runTasks(tasks);
+    double total = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+
+    for (const auto& timing : timings) 
+    {
+        std::ostringstream message;
+        message << "Startup load: " << timing.filename << ", records: " << timing.records
+            << ", " << std::fixed << std::setprecision(1) << timing.milliseconds << " ms";
+        logger->log(LogLevel::INFO, message.str());
+    }
+    std::ostringstream message;
+    message << "Startup data loaded in " << std::fixed << std::setprecision(1) << total << " ms";
+    logger->log(LogLevel::INFO, message.str());
+    return data;
+}
+
+void StartupLoader::runTasks(const std::vector<Task>& tasks) 
+{
+    timings.assign(tasks.size(), Timing());
+    std::vector<std::exception_ptr> errors(tasks.size());
+    std::atomic<size_t> next(0);
+
+    //            
+    auto worker = [&]() 
+    {
+        for (size_t i = next++; i < tasks.size(); i = next++) 
+        {
+            auto started = std::chrono::steady_clock::now();
+            try 
+            {
+                timings[i].records = tasks[i].load();
+            }
+            catch (...) 
+            {
+                errors[i] = std::current_exception();
+            }
+            timings[i].filename = tasks[i].filename;
+            timings[i].milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+        }
+    };
+
+    size_t threadCount = (std::min)(static_cast<size_t>(Config::STARTUP_LOAD_THREADS), tasks.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < threadCount; ++i) 
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) 
+    {
+        thread.join();
+    }
+
+    for (const auto& error : errors) 
+    {
+        if (error) 
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+const std::vector<StartupLoader::Timing>& StartupLoader::getTimings() const 
+{
+    return timings;
+}
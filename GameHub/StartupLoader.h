@@ -0,0 +1,50 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include "Config.h"
+#include "Logger.h"
+#include "FileManager.h"
+#include "Store.h"
+#include "Wishlist.h"
+#include "User.h"
+
+struct StartupData 
+{
+    std::vector<std::shared_ptr<User>> users;
+    StoreData store;
+    std::vector<Wishlist::WishlistItem> wishlistItems;
+};
+
+//     :       
+//    ,       
+class StartupLoader 
+{
+public:
+    struct Timing 
+    {
+        std::string filename;
+        size_t records;
+        double milliseconds;
+    };
+
+private:
+    struct Task 
+    {
+        std::string filename;
+        std::function<size_t()> load;
+    };
+
+    std::vector<Timing> timings;
+    FileManager fileManager;
+    Logger* logger;
+
+    void runTasks(const std::vector<Task>& tasks);
+
+public:
+    StartupLoader();
+
+    StartupData load();
+    const std::vector<Timing>& getTimings() const;
+};
@@ -1,98 +1,66 @@
 #include "Store.h"
 
-void Discount::serialize(std::ostream& os) const 
+std::vector<std::string> Discount::getTargetNames() const 
 {
-    size_t size = type.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(type.c_str(), size);
-
-    size_t targetsSize = targets.size();
-    os.write(reinterpret_cast<const char*>(&targetsSize), sizeof(targetsSize));
-    for (const auto& target : targets) 
-    {
-        size_t targetSize = target.size();
-        os.write(reinterpret_cast<const char*>(&targetSize), sizeof(targetSize));
-        os.write(target.c_str(), targetSize);
-    }
-
-    os.write(reinterpret_cast<const char*>(&percentage), sizeof(percentage));
-
-    size = startDate.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(startDate.c_str(), size);
-
-    size = endDate.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(endDate.c_str(), size);
+    return StringDictionary::getInstance()->textAll(targets);
 }
 
-void Discount::deserialize(std::istream& is) 
+bool Discount::isValid() const 
 {
-    size_t size;
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    type.resize(size);
-    is.read(&type[0], size);
-
-    size_t targetsSize;
-    is.read(reinterpret_cast<char*>(&targetsSize), sizeof(targetsSize));
-    targets.resize(targetsSize);
-    for (size_t i = 0; i < targetsSize; ++i) 
-    {
-        size_t targetSize;
-        is.read(reinterpret_cast<char*>(&targetSize), sizeof(targetSize));
-        std::string target(targetSize, ' ');
-        is.read(&target[0], targetSize);
-        targets[i] = target;
-    }
-
-    is.read(reinterpret_cast<char*>(&percentage), sizeof(percentage));
-
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    startDate.resize(size);
-    is.read(&startDate[0], size);
-
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    endDate.resize(size);
-    is.read(&endDate[0], size);
+    return isValidAt(std::time(nullptr));
 }
 
-bool Discount::isValid() const 
+bool Discount::isValidAt(std::time_t now) const 
 {
-    std::string currentDate = Config::getCurrentDateTime();
-    return currentDate >= startDate && currentDate <= endDate;
+    Timestamp moment(static_cast<int64_t>(now));
+    return startDate.isSet() && endDate.isSet() && moment >= startDate && moment <= endDate;
 }
 
-Store::Store() {
+Store::Store() : segmentClock(0), historyCustomerId(-1), journal(Config::SALES_JOURNAL_FILE), snapshotVersion(0), detailsDirty(false) {
     logger = Logger::getInstance();
+    idSequence = IdSequence::getInstance();
+    productDetails = std::make_shared<ProductDetailsStore>(Config::PRODUCT_DETAILS_FILE);
+    salesPartitions = std::make_shared<SalesPartitions>(Config::SALES_PARTITIONS_FILE);
     loadData();
 }
 
-int Store::generateProductId() 
+Store::Store(StoreData data) : segmentClock(0), historyCustomerId(-1), journal(Config::SALES_JOURNAL_FILE), snapshotVersion(0), detailsDirty(false) 
 {
-    if (products.empty()) return 1;
-    int maxId = 0;
-    for (const auto& product : products) 
+    logger = Logger::getInstance();
+    idSequence = IdSequence::getInstance();
+    productDetails = data.productDetails ? data.productDetails : std::make_shared<ProductDetailsStore>(Config::PRODUCT_DETAILS_FILE);
+    salesPartitions = data.salesPartitions ? data.salesPartitions : std::make_shared<SalesPartitions>(Config::SALES_PARTITIONS_FILE);
+    productsStamp = data.productsStamp;
+    products.swap(data.products);
+    discounts.swap(data.discounts);
+    initializeData();
+}
+
+Store::~Store() 
+{
+    try 
     {
-        if (product->getId() > maxId) 
+        //     products.idx:  ,       
+        awaitSearchIndex();
+        if (journal.getRecordCount() > 0) 
         {
-            maxId = product->getId();
+            checkpoint();
         }
     }
-    return maxId + 1;
+    catch (const std::exception& e) 
+    {
+        logger->log(LogLevel::ERR, std::string("Checkpoint on shutdown failed: ") + e.what());
+    }
+}
+
+int Store::generateProductId() 
+{
+    return idSequence->next("products");
 }
 
 int Store::generateSaleId() 
 {
-    if (sales.empty()) return 1;
-    int maxId = 0;
-    for (const auto& sale : sales) 
-    {
-        if (sale.getSaleId() > maxId) 
-        {
-            maxId = sale.getSaleId();
-        }
-    }
-    return maxId + 1;
+    return idSequence->next("sales");
 }
 
 void Store::addProduct(std::shared_ptr<Product> product) 
@@ -110,81 +78,204 @@ void Store::addProduct(std::shared_ptr<Product> product)
     );
     newProduct->setTags(product->getTags());
     newProduct->setActivationKeys(product->getActivationKeys());
+    newProduct->attachDetails(productDetails);
 
+    productSlots[newProduct->getId()] = products.size();
     products.push_back(newProduct);
+    hotProducts.append(*newProduct);
+    priceEngine.appendSlot();
+    productIndex.addProduct(*newProduct);
+    awaitSearchIndex();
+    searchIndex.addProduct(newProduct->getId(), newProduct->getTitle());
+    updateDiscountIndex(newProduct);
+    publishSnapshot();
+    detailsDirty = true;
     saveProducts();
     logger->log(LogLevel::INFO, "Product added: " + product->getTitle());
 }
 
-bool Store::updateProduct(int productId, std::shared_ptr<Product> updatedProduct) 
+void Store::rebuildProductIndex() 
 {
-    for (auto& product : products) 
+    productSlots.clear();
+    productSlots.reserve(products.size());
+    for (size_t slot = 0; slot < products.size(); ++slot) 
+    {
+        productSlots[products[slot]->getId()] = slot;
+    }
+
+    hotProducts.clear();
+    hotProducts.reserve(products.size());
+    for (const auto& product : products) 
     {
-        if (product->getId() == productId) 
+        hotProducts.append(*product);
+    }
+
+    //   ,         
+    if (!IndexFile::load(Config::PRODUCT_INDEX_FILE, productsStamp, productIndex, searchIndex) || searchIndex.size() != products.size()) 
+    {
+        productIndex.clear();
+        searchIndex.clear();
+        std::vector<std::pair<int, std::string>> titles;
+        titles.reserve(products.size());
+        for (const auto& product : products) 
         {
-            product->setTitle(updatedProduct->getTitle());
-            product->setBasePrice(updatedProduct->getBasePrice());
-            product->setDeveloper(updatedProduct->getDeveloper());
-            product->setPublisher(updatedProduct->getPublisher());
-            product->setGenre(updatedProduct->getGenre());
-            product->setAgeRating(updatedProduct->getAgeRating());
-            product->setDescription(updatedProduct->getDescription());
-            product->setTags(updatedProduct->getTags());
-            product->setActivationKeys(updatedProduct->getActivationKeys());
-
-            saveProducts();
-            logger->log(LogLevel::INFO, "Product updated: ID " + std::to_string(productId));
-            return true;
+            productIndex.addProduct(*product);
+            titles.emplace_back(product->getId(), product->getTitle());
         }
+
+        //   :         
+        BinaryWriter filters;
+        productIndex.write(filters);
+        IndexStamp stamp = productsStamp;
+        searchIndexBuild = std::async(std::launch::async, [titles = std::move(titles), filters = std::move(filters), stamp]() 
+            {
+                Logger* logger = Logger::getInstance();
+                logger->setConsoleOutput(false);
+                SearchIndex index;
+                for (const auto& title : titles) 
+                {
+                    index.addProduct(title.first, title.second);
+                }
+
+                try 
+                {
+                    IndexFile::save(Config::PRODUCT_INDEX_FILE, stamp, filters, index);
+                }
+                catch (const FileIOException& e) 
+                {
+                    logger->log(LogLevel::WARNING, std::string("Cannot save product indexes: ") + e.what());
+                }
+                logger->log(LogLevel::INFO, "Product indexes rebuilt, products: " + std::to_string(titles.size()));
+                return index;
+            });
+    }
+    discountScheduler.schedule(discounts, std::time(nullptr));
+    priceEngine.reset(products.size());
+    refreshPricing();
+}
+
+void Store::awaitSearchIndex() 
+{
+    if (searchIndexBuild.valid()) 
+    {
+        searchIndex = searchIndexBuild.get();
+    }
+}
+
+void Store::refreshPricing() 
+{
+    discountScheduler.advance(std::time(nullptr));
+    if (priceEngine.sync(discountScheduler, discounts, hotProducts)) 
+    {
+        refreshDiscountIndex();
     }
-    return false;
+}
+
+void Store::refreshDiscountIndex() 
+{
+    productIndex.clearDiscounted();
+    for (size_t slot = 0; slot < products.size(); ++slot) 
+    {
+        productIndex.setDiscounted(products[slot]->getId(), priceEngine.getBestDiscount(slot, hotProducts[slot], *products[slot]) > 0.0);
+    }
+}
+
+void Store::updateDiscountIndex(const std::shared_ptr<Product>& product) 
+{
+    productIndex.setDiscounted(product->getId(), getDiscountedPrice(product) < product->getBasePrice());
+}
+
+void Store::updateStock(const std::shared_ptr<Product>& product) 
+{
+    productIndex.updateStock(*product);
+    auto it = productSlots.find(product->getId());
+    if (it != productSlots.end()) 
+    {
+        hotProducts.updateStock(it->second, *product);
+    }
+}
+
+bool Store::updateProduct(int productId, std::shared_ptr<Product> updatedProduct) 
+{
+    auto product = getProductById(productId);
+    if (!product) 
+    {
+        return false;
+    }
+
+    productIndex.removeProduct(*product);
+    product->setTitle(updatedProduct->getTitle());
+    product->setBasePrice(updatedProduct->getBasePrice());
+    product->setDeveloper(updatedProduct->getDeveloper());
+    product->setPublisher(updatedProduct->getPublisher());
+    product->setGenre(updatedProduct->getGenre());
+    product->setAgeRating(updatedProduct->getAgeRating());
+    product->setDescription(updatedProduct->getDescription());
+    product->setTags(updatedProduct->getTags());
+    product->setActivationKeys(updatedProduct->getActivationKeys());
+    productIndex.addProduct(*product);
+    awaitSearchIndex();
+    searchIndex.addProduct(productId, product->getTitle());
+    hotProducts.assign(productSlots[productId], *product);
+    priceEngine.invalidateSlot(productSlots[productId]);
+    updateDiscountIndex(product);
+    publishSnapshot();
+    detailsDirty = true;
+
+    saveProducts();
+    logger->log(LogLevel::INFO, "Product updated: ID " + std::to_string(productId));
+    return true;
 }
 
 bool Store::deleteProduct(int productId) 
 {
-    auto it = std::remove_if(products.begin(), products.end(),
-        [productId](const std::shared_ptr<Product>& product) 
-        {
-            return product->getId() == productId;
-        });
+    auto it = productSlots.find(productId);
+    if (it == productSlots.end()) 
+    {
+        return false;
+    }
+
+    size_t slot = it->second;
+    productSlots.erase(it);
+    productIndex.removeProduct(*products[slot]);
+    awaitSearchIndex();
+    searchIndex.removeProduct(productId);
+    priceEngine.eraseSlot(slot);
+    hotProducts.erase(slot);
+    products.erase(products.begin() + slot);
 
-    if (it != products.end()) 
+    for (size_t i = slot; i < products.size(); ++i) 
     {
-        products.erase(it, products.end());
-        saveProducts();
-        logger->log(LogLevel::INFO, "Product deleted: ID " + std::to_string(productId));
-        return true;
+        productSlots[products[i]->getId()] = i;
     }
-    return false;
+    publishSnapshot();
+    detailsDirty = true;
+
+    saveProducts();
+    logger->log(LogLevel::INFO, "Product deleted: ID " + std::to_string(productId));
+    return true;
 }
 
 std::shared_ptr<Product> Store::getProductById(int id) 
 {
-    for (const auto& product : products) 
+    auto it = productSlots.find(id);
+    if (it == productSlots.end()) 
     {
-        if (product->getId() == id) 
-        {
-            return product;
-        }
+        return nullptr;
     }
-    return nullptr;
+    return products[it->second];
 }
 
 std::vector<std::shared_ptr<Product>> Store::searchProducts(const std::string& query) 
 {
     std::vector<std::shared_ptr<Product>> results;
-    std::string lowerQuery = query;
-    std::transform(lowerQuery.begin(), lowerQuery.end(), lowerQuery.begin(), ::tolower);
+    awaitSearchIndex();
+    auto productIds = searchIndex.search(query);
 
-    for (const auto& product : products) 
+    results.reserve(productIds.size());
+    for (int productId : productIds) 
     {
-        std::string lowerTitle = product->getTitle();
-        std::transform(lowerTitle.begin(), lowerTitle.end(), lowerTitle.begin(), ::tolower);
-
-        if (lowerTitle.find(lowerQuery) != std::string::npos) 
-        {
-            results.push_back(product);
-        }
+        results.push_back(products[productSlots[productId]]);
     }
     return results;
 }
@@ -192,29 +283,38 @@ std::vector<std::shared_ptr<Product>> Store::searchProducts(const std::string& q
 std::vector<std::shared_ptr<Product>> Store::filterProducts(const std::string& filterType, const std::string& filterValue) 
 {
     std::vector<std::shared_ptr<Product>> results;
+    const std::set<int>* productIds = nullptr;
 
-    for (const auto& product : products) 
+    if (filterType == "genre") 
     {
-        if (filterType == "genre" && product->getGenre() == filterValue) 
-        {
-            results.push_back(product);
-        }
-        else if (filterType == "developer" && product->getDeveloper() == filterValue) 
-        {
-            results.push_back(product);
-        }
-        else if (filterType == "tag" && product->hasTag(filterValue)) 
-        {
-            results.push_back(product);
-        }
-        else if (filterType == "has_discount" && getDiscountedPrice(product) < product->getBasePrice()) 
-        {
-            results.push_back(product);
-        }
-        else if (filterType == "in_stock" && product->hasKeys()) 
-        {
-            results.push_back(product);
-        }
+        productIds = &productIndex.getByGenre(filterValue);
+    }
+    else if (filterType == "developer") 
+    {
+        productIds = &productIndex.getByDeveloper(filterValue);
+    }
+    else if (filterType == "tag") 
+    {
+        productIds = &productIndex.getByTag(filterValue);
+    }
+    else if (filterType == "has_discount") 
+    {
+        refreshPricing();
+        productIds = &productIndex.getDiscounted();
+    }
+    else if (filterType == "in_stock") 
+    {
+        productIds = &productIndex.getInStock();
+    }
+    else 
+    {
+        return results;
+    }
+
+    results.reserve(productIds->size());
+    for (int productId : *productIds) 
+    {
+        results.push_back(products[productSlots[productId]]);
     }
     return results;
 }
@@ -225,6 +325,8 @@ bool Store::addKeys(int productId, int count)
     if (product) 
     {
         product->addKeys(count);
+        updateStock(product);
+        publishSnapshot();
         saveProducts();
 
         if (count < 5) 
@@ -243,118 +345,462 @@ bool Store::addKeys(int productId, int count)
 void Store::addDiscount(const Discount& discount) 
 {
     discounts.push_back(discount);
+    discountScheduler.schedule(discounts, std::time(nullptr));
+    refreshPricing();
+    publishSnapshot();
     saveDiscounts();
     logger->log(LogLevel::INFO, "Discount added: " + discount.type + " " + std::to_string(discount.percentage) + "%");
 }
 
 double Store::getDiscountedPrice(std::shared_ptr<Product> product) 
 {
-    double price = product->getBasePrice();
-    double bestDiscount = 0.0;
+    refreshPricing();
+
+    double bestDiscount;
+    auto it = productSlots.find(product->getId());
+    if (it != productSlots.end() && products[it->second] == product) 
+    {
+        bestDiscount = priceEngine.getBestDiscount(it->second, hotProducts[it->second], *product);
+    }
+    else 
+    {
+        bestDiscount = priceEngine.getBestDiscount(hotProducts.describe(*product), *product);
+    }
 
-    for (const auto& discount : discounts) 
+    return product->getBasePrice() * (1.0 - bestDiscount / 100.0);
+}
+
+bool Store::processSale(int customerId, const std::vector<std::pair<int, int>>& items, double discountAmount) {
+    SaleOrder order;
+    order.customerId = customerId;
+    order.items = items;
+    order.discountAmount = discountAmount;
+
+    SaleResult result = processSales({ order }).front();
+    if (!result.success) 
     {
-        if (!discount.isValid()) continue;
+        throw BusinessLogicError(result.error);
+    }
+
+    logger->log(LogLevel::INFO, "Sale processed: ID " + std::to_string(result.saleId) + ", Customer: " + std::to_string(customerId));
+    return true;
+}
+
+std::vector<SaleResult> Store::processSales(const std::vector<SaleOrder>& orders) 
+{
+    std::vector<SaleResult> results(orders.size());
+    std::vector<SaleJournal::Record> records;
+    records.reserve(orders.size());
+    std::unordered_map<int, int> reservedKeys;
 
-        if (discount.type == "product")
+    for (size_t i = 0; i < orders.size(); ++i) 
+    {
+        const SaleOrder& order = orders[i];
+        SaleResult& result = results[i];
+        result.success = false;
+        result.saleId = 0;
+
+        try 
         {
-            for (const auto& target : discount.targets)
+            double totalAmount = 0.0;
+            std::unordered_map<int, int> orderKeys;
+            for (const auto& item : order.items) 
             {
-                if (std::to_string(product->getId()) == target)
+                auto product = getProductById(item.first);
+                if (!product) 
+                {
+                    throw BusinessLogicError("Product not found: ID " + std::to_string(item.first));
+                }
+                if (item.second <= 0) 
+                {
+                    throw BusinessLogicError("Invalid quantity for product: " + product->getTitle());
+                }
+
+                int requested = reservedKeys[item.first] + orderKeys[item.first] + item.second;
+                if (!product->hasKeys() || product->getActivationKeys() < requested) 
                 {
-                    bestDiscount = (std::max)(bestDiscount, discount.percentage);
-                    break;
+                    throw BusinessLogicError("Not enough keys for product: " + product->getTitle());
                 }
+                totalAmount += getDiscountedPrice(product) * item.second;
+                orderKeys[item.first] += item.second;
+            }
+
+            for (const auto& entry : orderKeys) 
+            {
+                reservedKeys[entry.first] += entry.second;
             }
+
+            SaleJournal::Record record;
+            record.sale = Sale(generateSaleId(), order.customerId, order.items, totalAmount, order.discountAmount);
+            record.keyDecrements = order.items;
+            records.push_back(record);
+
+            result.success = true;
+            result.saleId = record.sale.getSaleId();
         }
-        else if (discount.type == "genre" && std::find(discount.targets.begin(), discount.targets.end(), product->getGenre()) != discount.targets.end()) 
+        catch (const BusinessLogicError& e) 
         {
-            bestDiscount = (std::max)(bestDiscount, discount.percentage);
+            result.error = e.what();
         }
-        else if (discount.type == "developer" && std::find(discount.targets.begin(), discount.targets.end(), product->getDeveloper()) != discount.targets.end()) 
+    }
+
+    if (records.empty()) 
+    {
+        return results;
+    }
+
+    journal.appendBatch(records);
+
+    pendingSales.reserve(pendingSales.size() + records.size());
+    for (const auto& record : records) 
+    {
+        for (const auto& decrement : record.keyDecrements) 
         {
-            bestDiscount = (std::max)(bestDiscount, discount.percentage);
+            auto product = getProductById(decrement.first);
+            product->reserveKeys(decrement.second);
+            product->setLastSaleId(record.sale.getSaleId());
+            updateStock(product);
         }
-        else if (discount.type == "tag") 
+
+        appendSale(record.sale);
+    }
+
+    publishSnapshot();
+    if (journal.getRecordCount() >= Config::JOURNAL_CHECKPOINT_INTERVAL) 
+    {
+        checkpoint();
+    }
+
+    if (orders.size() > 1) 
+    {
+        logger->log(LogLevel::INFO, "Sales batch processed: " + std::to_string(records.size()) + " of " + std::to_string(orders.size()) + " orders");
+    }
+    return results;
+}
+
+std::vector<std::shared_ptr<Product>> Store::getAllProducts() const 
+{
+    return products;
+}
+
+std::vector<Discount> Store::getAllDiscounts() const 
+{
+    return discounts;
+}
+
+std::vector<Sale> Store::getAllSales() const 
+{
+    std::vector<Sale> result = salesPartitions->loadAll();
+    result.insert(result.end(), pendingSales.begin(), pendingSales.end());
+    return result;
+}
+
+size_t Store::getSaleCount() const 
+{
+    return salesPartitions->getSaleCount() + pendingSales.size();
+}
+
+std::vector<Sale> Store::getCustomerSales(int customerId) 
+{
+    if (customerId != historyCustomerId) 
+    {
+        customerHistory = salesPartitions->loadCustomer(customerId);
+        for (const auto& sale : pendingSales) 
         {
-            for (const auto& tag : product->getTags()) 
+            if (sale.getCustomerId() == customerId) 
             {
-                if (std::find(discount.targets.begin(), discount.targets.end(), tag) != discount.targets.end()) 
-                {
-                    bestDiscount = (std::max)(bestDiscount, discount.percentage);
-                    break;
-                }
+                customerHistory.push_back(sale);
             }
         }
+        historyCustomerId = customerId;
     }
+    return customerHistory;
+}
 
-    return price * (1.0 - bestDiscount / 100.0);
+Snapshot<std::shared_ptr<Product>> Store::getProductsSnapshot() const 
+{
+    return Snapshot<std::shared_ptr<Product>>(products, snapshotVersion);
 }
 
-bool Store::processSale(int customerId, const std::vector<std::pair<int, int>>& items, double discountAmount) {
-    double totalAmount = 0.0;
+const HotProductTable& Store::getHotProducts() const 
+{
+    return hotProducts;
+}
+
+Snapshot<Discount> Store::getDiscountsSnapshot() const 
+{
+    return Snapshot<Discount>(discounts, snapshotVersion);
+}
 
-    for (const auto& item : items) 
+unsigned long Store::getSnapshotVersion() const 
+{
+    return snapshotVersion;
+}
+
+void Store::appendSale(const Sale& sale) 
+{
+    pendingSales.push_back(sale);
+
+    // ,     ,        
+    std::time_t time = static_cast<std::time_t>(sale.getSaleDateTime().getSeconds());
+    auto it = salesSegments.find(salesPartitions->writableMonth(time));
+    if (it != salesSegments.end()) 
+    {
+        it->second.add(sale);
+    }
+    if (sale.getCustomerId() == historyCustomerId) 
+    {
+        customerHistory.push_back(sale);
+    }
+}
+
+SalesSegment& Store::loadSegment(int month) 
+{
+    auto it = salesSegments.find(month);
+    if (it != salesSegments.end()) 
+    {
+        it->second.lastUsed = ++segmentClock;
+        return it->second;
+    }
+
+    SalesSegment& segment = salesSegments[month];
+    for (const auto& sale : salesPartitions->load(month)) 
     {
-        auto product = getProductById(item.first);
-        if (!product) 
+        segment.add(sale);
+    }
+    for (const auto& sale : pendingSales) 
+    {
+        if (salesPartitions->writableMonth(static_cast<std::time_t>(sale.getSaleDateTime().getSeconds())) == month) 
         {
-            throw BusinessLogicError("Product not found: ID " + std::to_string(item.first));
+            segment.add(sale);
         }
-        if (!product->hasKeys() || product->getActivationKeys() < item.second) 
+    }
+    segment.lastUsed = ++segmentClock;
+    evictSegments(month);
+    return segment;
+}
+
+void Store::evictSegments(int keepMonth) 
+{
+    size_t total = 0;
+    for (const auto& entry : salesSegments) 
+    {
+        total += entry.second.memoryUsage();
+    }
+
+    //           
+    while (total > Config::SALES_MEMORY_BUDGET && salesSegments.size() > 1) 
+    {
+        auto victim = salesSegments.end();
+        for (auto it = salesSegments.begin(); it != salesSegments.end(); ++it) 
         {
-            throw BusinessLogicError("Not enough keys for product: " + product->getTitle());
+            if (it->first != keepMonth && (victim == salesSegments.end() || it->second.lastUsed < victim->second.lastUsed)) 
+            {
+                victim = it;
+            }
         }
-        totalAmount += getDiscountedPrice(product) * item.second;
+        total -= victim->second.memoryUsage();
+        logger->log(LogLevel::INFO, "Sales segment unloaded: " + std::to_string(victim->first));
+        salesSegments.erase(victim);
     }
+}
 
-    int saleId = generateSaleId();
-    Sale sale(saleId, customerId, items, totalAmount, discountAmount);
+SalesCube::Bucket Store::collectSales(std::time_t start, std::time_t end) 
+{
+    //         ,     
+    std::set<int> months;
+    for (int month : salesPartitions->overlapping(start, end)) 
+    {
+        months.insert(month);
+    }
+    for (const auto& entry : salesSegments) 
+    {
+        if (entry.second.overlaps(start, end)) 
+        {
+            months.insert(entry.first);
+        }
+    }
+    for (const auto& sale : pendingSales) 
+    {
+        std::time_t time = static_cast<std::time_t>(sale.getSaleDateTime().getSeconds());
+        if (time >= start && time <= end) 
+        {
+            months.insert(salesPartitions->writableMonth(time));
+        }
+    }
 
-    for (const auto& item : items) 
+    SalesCube::Bucket totals;
+    for (int month : months) 
     {
-        auto product = getProductById(item.first);
-        product->reserveKeys(item.second);
+        const SalesSegment& segment = loadSegment(month);
+        totals.merge(segment.cube.collect(segment.table, start, end));
     }
+    return totals;
+}
 
-    sales.push_back(sale);
-    saveSales();
-    saveProducts();
+void Store::publishSnapshot() 
+{
+    snapshotVersion++;
+}
 
-    logger->log(LogLevel::INFO, "Sale processed: ID " + std::to_string(saleId) + ", Customer: " + std::to_string(customerId));
-    return true;
+void Store::loadData() 
+{
+    productsStamp = IndexFile::stampOf(Config::PRODUCTS_FILE);
+    products = fileManager.loadFromFile<std::shared_ptr<Product>>(Config::PRODUCTS_FILE);
+    discounts = fileManager.loadFromFile<Discount>(Config::DISCOUNTS_FILE);
+    initializeData();
 }
 
-std::vector<std::shared_ptr<Product>> Store::getAllProducts() const 
+void Store::initializeData() 
 {
-    return products;
+    //        :     
+    for (const auto& product : products) 
+    {
+        if (product->hasDetailsLoaded()) 
+        {
+            detailsDirty = true;
+        }
+        product->attachDetails(productDetails);
+    }
+
+    //   ,     
+    salesSegments.clear();
+    pendingSales.clear();
+    historyCustomerId = -1;
+    customerHistory.clear();
+
+    rebuildProductIndex();
+    replayJournal();
+    publishSnapshot();
+
+    int maxProductId = 0;
+    for (const auto& product : products) 
+    {
+        maxProductId = (std::max)(maxProductId, product->getId());
+    }
+    int maxSaleId = salesPartitions->getMaxSaleId();
+    for (const auto& sale : pendingSales) 
+    {
+        maxSaleId = (std::max)(maxSaleId, sale.getSaleId());
+    }
+    idSequence->observe("products", maxProductId);
+    idSequence->observe("sales", maxSaleId);
+
+    if (detailsDirty) 
+    {
+        logger->log(LogLevel::INFO, "Moving product details to " + Config::PRODUCT_DETAILS_FILE);
+        saveProducts();
+    }
 }
 
-std::vector<Discount> Store::getAllDiscounts() const 
+void Store::replayJournal() 
 {
-    return discounts;
+    auto records = journal.load();
+    if (records.empty()) 
+    {
+        return;
+    }
+
+    //       ,    ,
+    //           
+    auto writtenSaleIds = salesPartitions->readMaxSaleIds();
+
+    size_t replayed = 0;
+    for (const auto& record : records) 
+    {
+        std::time_t time = static_cast<std::time_t>(record.sale.getSaleDateTime().getSeconds());
+        auto written = writtenSaleIds.find(salesPartitions->writableMonth(time));
+        if (written != writtenSaleIds.end() && record.sale.getSaleId() <= written->second) 
+        {
+            continue;
+        }
+
+        for (const auto& decrement : record.keyDecrements) 
+        {
+            auto product = getProductById(decrement.first);
+            //      ,     
+            if (!product || record.sale.getSaleId() <= product->getLastSaleId()) 
+            {
+                continue;
+            }
+            if (!product->reserveKeys(decrement.second)) 
+            {
+                logger->log(LogLevel::WARNING, "Journal replay: not enough keys for product ID " + std::to_string(decrement.first));
+                product->setActivationKeys(0);
+            }
+            product->setLastSaleId(record.sale.getSaleId());
+            updateStock(product);
+        }
+
+        appendSale(record.sale);
+        replayed++;
+    }
+
+    logger->log(LogLevel::INFO, "Journal replayed, sales restored: " + std::to_string(replayed));
 }
 
-std::vector<Sale> Store::getAllSales() const 
+bool Store::checkpoint() 
 {
-    return sales;
+    //    :     ,     
+    //        ,   .     
+    //    :    ,     
+    if (!writeProducts() || !FileManager::flushPendingWrites()) 
+    {
+        logger->log(LogLevel::ERR, "Journal checkpoint failed: products are not written, journal is kept for replay");
+        return false;
+    }
+    size_t written = pendingSales.size();
+    if (!salesPartitions->append(pendingSales)) 
+    {
+        logger->log(LogLevel::ERR, "Journal checkpoint failed: sales are not written to partitions, journal is kept for replay");
+        return false;
+    }
+
+    //     ,        
+    journal.clear();
+    logger->log(LogLevel::INFO, "Journal checkpoint completed, sales: " + std::to_string(written));
+    return true;
 }
 
-void Store::loadData() 
+bool Store::saveProducts() 
 {
-    products = fileManager.loadFromFile<std::shared_ptr<Product>>(Config::PRODUCTS_FILE);
-    sales = fileManager.loadFromFile<Sale>(Config::SALES_FILE);
-    discounts = fileManager.loadFromFile<Discount>(Config::DISCOUNTS_FILE);
+    if (journal.getRecordCount() > 0) 
+    {
+        return checkpoint();
+    }
+    return writeProducts();
 }
 
-void Store::saveProducts() 
+bool Store::writeProducts() 
 {
-    fileManager.saveToFile(Config::PRODUCTS_FILE, products);
+    //   : products.dat      ,
+    //        
+    if (detailsDirty) 
+    {
+        if (!productDetails->save(products)) 
+        {
+            logger->log(LogLevel::ERR, "Cannot save " + Config::PRODUCT_DETAILS_FILE + ", " + Config::PRODUCTS_FILE + " is not written");
+            return false;
+        }
+        detailsDirty = false;
+    }
+    if (!fileManager.saveToFile(Config::PRODUCTS_FILE, products)) 
+    {
+        logger->log(LogLevel::ERR, "Cannot save " + Config::PRODUCTS_FILE);
+        return false;
+    }
+    return true;
 }
 
 void Store::saveSales() 
 {
-    fileManager.saveToFile(Config::SALES_FILE, sales);
+    if (journal.getRecordCount() > 0) 
+    {
+        checkpoint();
+        return;
+    }
+    //    ,     
+    salesPartitions->append(pendingSales);
 }
 
 void Store::saveDiscounts()
@@ -364,27 +810,11 @@ void Store::saveDiscounts()
 
 std::vector<std::string> Store::getUniqueGenres() 
 {
-    std::vector<std::string> genres;
-    for (const auto& product : products) 
-    {
-        if (std::find(genres.begin(), genres.end(), product->getGenre()) == genres.end()) 
-        {
-            genres.push_back(product->getGenre());
-        }
-    }
-    return genres;
+    return productIndex.getGenres();
 }
 
 std::vector<std::string> Store::getUniqueDevelopers() 
 {
-    std::vector<std::string> developers;
-    for (const auto& product : products) 
-    {
-        if (std::find(developers.begin(), developers.end(), product->getDeveloper()) == developers.end()) 
-        {
-            developers.push_back(product->getDeveloper());
-        }
-    }
-    return developers;
+    return productIndex.getDevelopers();
 }
 
@@ -3,26 +3,75 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <algorithm>
 #include <memory>
+#include <future>
 #include "Product.h"
 #include "User.h"
 #include "Sale.h"
+#include "Timestamp.h"
+#include "Schema.h"
+#include "ProductIndex.h"
+#include "ProductDetailsStore.h"
+#include "HotProductTable.h"
+#include "PriceEngine.h"
+#include "SearchIndex.h"
+#include "IndexFile.h"
+#include "Snapshot.h"
+#include "SalesTable.h"
+#include "SalesCube.h"
+#include "SalesPartitions.h"
 #include "FileManager.h"
+#include "IdSequence.h"
+#include "SaleJournal.h"
 #include "Logger.h"
 #include "Exceptions.h"
 
 struct Discount 
 {
     std::string type;
-    std::vector<std::string> targets;
+    std::vector<StringId> targets;
     double percentage;
-    std::string startDate;
-    std::string endDate;
+    Timestamp startDate;
+    Timestamp endDate;
 
-    void serialize(std::ostream& os) const;
-    void deserialize(std::istream& is);
+    static auto fields() 
+    {
+        return std::make_tuple(
+            Schema::field(&Discount::type),
+            Schema::converted<1, 3, std::vector<std::string>>(&Discount::targets), Schema::field<3>(&Discount::targets),
+            Schema::field(&Discount::percentage), Schema::field(&Discount::startDate), Schema::field(&Discount::endDate));
+    }
+
+    std::vector<std::string> getTargetNames() const;
     bool isValid() const;
+    bool isValidAt(std::time_t now) const;
+};
+
+//   ,    Store,    
+struct StoreData 
+{
+    std::vector<std::shared_ptr<Product>> products;
+    std::vector<Discount> discounts;
+    std::shared_ptr<ProductDetailsStore> productDetails;
+    std::shared_ptr<SalesPartitions> salesPartitions;
+    //   ,    
+    IndexStamp productsStamp;
+};
+
+struct SaleOrder 
+{
+    int customerId;
+    std::vector<std::pair<int, int>> items;
+    double discountAmount;
+};
+
+struct SaleResult 
+{
+    bool success;
+    int saleId;
+    std::string error;
 };
 
 class Store 
@@ -30,15 +79,55 @@ class Store
 private:
     std::vector<std::shared_ptr<Product>> products;
     std::vector<Discount> discounts;
-    std::vector<Sale> sales;
+    // ,      ;       
+    std::vector<Sale> pendingSales;
+    std::shared_ptr<SalesPartitions> salesPartitions;
+    //    :       ,
+    //    Config::SALES_MEMORY_BUDGET    
+    std::map<int, SalesSegment> salesSegments;
+    uint64_t segmentClock;
+    //     
+    int historyCustomerId;
+    std::vector<Sale> customerHistory;
+    std::unordered_map<int, size_t> productSlots;
+    HotProductTable hotProducts;
+    std::shared_ptr<ProductDetailsStore> productDetails;
+    //     products.idx.   ,     :
+    //       .      
+    //       ;       
+    ProductIndex productIndex;
+    SearchIndex searchIndex;
+    std::future<SearchIndex> searchIndexBuild;
+    IndexStamp productsStamp;
+    PriceEngine priceEngine;
+    DiscountScheduler discountScheduler;
     FileManager fileManager;
+    SaleJournal journal;
+    IdSequence* idSequence;
     Logger* logger;
+    unsigned long snapshotVersion;
+    bool detailsDirty;
 
     int generateProductId();
     int generateSaleId();
+    void rebuildProductIndex();
+    void awaitSearchIndex();
+    void refreshDiscountIndex();
+    void refreshPricing();
+    void updateDiscountIndex(const std::shared_ptr<Product>& product);
+    void updateStock(const std::shared_ptr<Product>& product);
+    bool writeProducts();
+    void replayJournal();
+    void publishSnapshot();
+    void initializeData();
+    void appendSale(const Sale& sale);
+    SalesSegment& loadSegment(int month);
+    void evictSegments(int keepMonth);
 
 public:
     Store();
+    explicit Store(StoreData data);
+    ~Store();
 
     void addProduct(std::shared_ptr<Product> product);
     bool updateProduct(int productId, std::shared_ptr<Product> updatedProduct);
@@ -53,15 +142,28 @@ public:
     double getDiscountedPrice(std::shared_ptr<Product> product);
 
     bool processSale(int customerId, const std::vector<std::pair<int, int>>& items, double discountAmount = 0.0);
+    std::vector<SaleResult> processSales(const std::vector<SaleOrder>& orders);
 
     std::vector<std::shared_ptr<Product>> getAllProducts() const;
     std::vector<Discount> getAllDiscounts() const;
+    //      
     std::vector<Sale> getAllSales() const;
+    std::vector<Sale> getCustomerSales(int customerId);
+    //         
+    size_t getSaleCount() const;
+
+    Snapshot<std::shared_ptr<Product>> getProductsSnapshot() const;
+    const HotProductTable& getHotProducts() const;
+    Snapshot<Discount> getDiscountsSnapshot() const;
+    unsigned long getSnapshotVersion() const;
+    //     ( )  ,   
+    SalesCube::Bucket collectSales(std::time_t start, std::time_t end);
 
     void loadData();
-    void saveProducts();
+    bool saveProducts();
     void saveSales();
     void saveDiscounts();
+    bool checkpoint();
 
     std::vector<std::string> getUniqueGenres();
     std::vector<std::string> getUniqueDevelopers();
@@ -0,0 +1,119 @@
+#include "StringDictionary.h"
+#include "FileManager.h"
+
+StringDictionary* StringDictionary::instance = nullptr;
+std::mutex StringDictionary::mtx;
+const StringId StringDictionary::EMPTY;
+
+StringDictionary::StringDictionary() 
+{
+    logger = Logger::getInstance();
+
+    FileManager fileManager;
+    for (const auto& value : fileManager.loadStringList(Config::DICTIONARY_FILE)) 
+    {
+        ids.emplace(value, static_cast<StringId>(values.size()));
+        values.push_back(value);
+    }
+    persistedCount = values.size();
+
+    if (values.empty()) 
+    {
+        ids.emplace(std::string(), EMPTY);
+        values.push_back(std::string());
+    }
+}
+
+StringDictionary* StringDictionary::getInstance() 
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    if (instance == nullptr) 
+    {
+        instance = new StringDictionary();
+    }
+    return instance;
+}
+
+StringId StringDictionary::intern(const std::string& value) 
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = ids.find(value);
+    if (it != ids.end()) 
+    {
+        return it->second;
+    }
+
+    StringId id = static_cast<StringId>(values.size());
+    values.push_back(value);
+    ids.emplace(value, id);
+    return id;
+}
+
+bool StringDictionary::find(const std::string& value, StringId& id) const 
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = ids.find(value);
+    if (it == ids.end()) 
+    {
+        return false;
+    }
+    id = it->second;
+    return true;
+}
+
+//  deque    ,   
+const std::string& StringDictionary::text(StringId id) const 
+{
+    static const std::string unknown;
+    std::lock_guard<std::mutex> lock(mtx);
+    return id < values.size() ? values[id] : unknown;
+}
+
+std::vector<StringId> StringDictionary::internAll(const std::vector<std::string>& list) 
+{
+    std::vector<StringId> result;
+    result.reserve(list.size());
+    for (const auto& value : list) 
+    {
+        result.push_back(intern(value));
+    }
+    return result;
+}
+
+std::vector<std::string> StringDictionary::textAll(const std::vector<StringId>& list) const 
+{
+    std::vector<std::string> result;
+    result.reserve(list.size());
+    for (StringId id : list) 
+    {
+        result.push_back(text(id));
+    }
+    return result;
+}
+
+//       ,      -  
+bool StringDictionary::flush() 
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    if (persistedCount == values.size()) 
+    {
+        return true;
+    }
+
+    std::vector<std::string> pending(values.begin() + persistedCount, values.end());
+    FileManager fileManager;
+    //        ,   
+    if (!fileManager.appendToStringList(Config::DICTIONARY_FILE, pending, true) || !FileManager::flushPendingWrites()) 
+    {
+        logger->log(LogLevel::ERR, "Cannot persist string dictionary: " + Config::DICTIONARY_FILE);
+        return false;
+    }
+    persistedCount = values.size();
+    return true;
+}
+
+size_t StringDictionary::size() const 
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    return values.size();
+}
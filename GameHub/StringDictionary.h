@@ -0,0 +1,69 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <mutex>
+#include <cstdint>
+#include "Config.h"
+#include "Logger.h"
+#include "Schema.h"
+
+typedef uint32_t StringId;
+
+//      (, , , ).
+//   -    strings.dat;   , 
+// ,    ,  .  0 -  .
+class StringDictionary 
+{
+private:
+    static StringDictionary* instance;
+    static std::mutex mtx;
+
+    std::deque<std::string> values;
+    std::unordered_map<std::string, StringId> ids;
+    size_t persistedCount;
+    Logger* logger;
+
+    StringDictionary();
+
+public:
+    static const StringId EMPTY = 0;
+
+    static StringDictionary* getInstance();
+
+    StringId intern(const std::string& value);
+    bool find(const std::string& value, StringId& id) const;
+    const std::string& text(StringId id) const;
+
+    std::vector<StringId> internAll(const std::vector<std::string>& list);
+    std::vector<std::string> textAll(const std::vector<StringId>& list) const;
+
+    bool flush();
+    size_t size() const;
+
+    StringDictionary(const StringDictionary&) = delete;
+    StringDictionary& operator=(const StringDictionary&) = delete;
+};
+
+//         
+namespace Schema 
+{
+    template<>
+    struct Convert<std::string, StringId> 
+    {
+        static void apply(const std::string& text, StringId& id) 
+        {
+            id = StringDictionary::getInstance()->intern(text);
+        }
+    };
+
+    template<>
+    struct Convert<std::vector<std::string>, std::vector<StringId>> 
+    {
+        static void apply(const std::vector<std::string>& list, std::vector<StringId>& result) 
+        {
+            result = StringDictionary::getInstance()->internAll(list);
+        }
+    };
+}
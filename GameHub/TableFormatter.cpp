@@ -170,7 +170,7 @@ void TableFormatter::displaySalesTable(const std::vector<Sale>& sales, int page)
 
         std::cout << "| " << std::setw(columnWidths[0]) << std::right << sale.getSaleId()
             << " | " << std::setw(columnWidths[1]) << std::right << sale.getCustomerId()
-            << " | " << std::setw(columnWidths[2]) << std::left << truncateString(sale.getSaleDateTime(), columnWidths[2])
+            << " | " << std::setw(columnWidths[2]) << std::left << truncateString(sale.getSaleDateTime().toString(), columnWidths[2])
             << " | " << std::setw(columnWidths[3]) << std::right << totalItems
             << " | " << std::setw(columnWidths[4]) << std::right << std::fixed << std::setprecision(2) << sale.getTotalAmount()
             << " | " << std::setw(columnWidths[5]) << std::right << std::fixed << std::setprecision(2) << sale.getDiscountAmount()
@@ -296,13 +296,14 @@ void TableFormatter::displayProductDetails(std::shared_ptr<Product> product)
         << " | " << std::setw(widths[1]) << std::left << std::to_string(product->getActivationKeys())
         << " |" << std::endl;
 
-    if (!product->getTags().empty()) 
+    auto tagNames = product->getTags();
+    if (!tagNames.empty()) 
     {
         std::string tags;
-        for (size_t i = 0; i < product->getTags().size(); ++i) 
+        for (size_t i = 0; i < tagNames.size(); ++i) 
         {
-            tags += product->getTags()[i];
-            if (i < product->getTags().size() - 1) tags += ", ";
+            tags += tagNames[i];
+            if (i < tagNames.size() - 1) tags += ", ";
         }
         std::cout << "| " << std::setw(widths[0]) << std::left << ""
             << " | " << std::setw(widths[1]) << std::left << tags
@@ -515,17 +516,18 @@ void TableFormatter::displayDiscountsTable(const std::vector<Discount>& discount
         const Discount& discount = discounts[i];
 
         std::string targetsStr;
-        if (discount.targets.size() <= 2) 
+        auto targets = discount.getTargetNames();
+        if (targets.size() <= 2) 
         {
-            for (size_t j = 0; j < discount.targets.size(); j++) 
+            for (size_t j = 0; j < targets.size(); j++) 
             {
-                targetsStr += discount.targets[j];
-                if (j < discount.targets.size() - 1) targetsStr += ", ";
+                targetsStr += targets[j];
+                if (j < targets.size() - 1) targetsStr += ", ";
             }
         }
         else 
         {
-            targetsStr = discount.targets[0] + ", " + discount.targets[1] + "...";
+            targetsStr = targets[0] + ", " + targets[1] + "...";
         }
 
         std::string status = discount.isValid() ? "" : "";
@@ -543,8 +545,8 @@ void TableFormatter::displayDiscountsTable(const std::vector<Discount>& discount
             << " | " << std::setw(columnWidths[1]) << std::left << truncateString(discount.type, columnWidths[1])
             << " | " << std::setw(columnWidths[2]) << std::left << truncateString(targetsStr, columnWidths[2])
             << " | " << std::setw(columnWidths[3]) << std::right << std::fixed << std::setprecision(1) << discount.percentage
-            << " | " << std::setw(columnWidths[4]) << std::left << truncateString(discount.startDate, columnWidths[4])
-            << " | " << std::setw(columnWidths[5]) << std::left << truncateString(discount.endDate, columnWidths[5])
+            << " | " << std::setw(columnWidths[4]) << std::left << truncateString(discount.startDate.toString(), columnWidths[4])
+            << " | " << std::setw(columnWidths[5]) << std::left << truncateString(discount.endDate.toString(), columnWidths[5])
             << " | " << std::setw(columnWidths[6]) << std::left << status
             << " |" << std::endl;
 
@@ -603,18 +605,19 @@ void TableFormatter::displayDiscountsTableWithPagination(const std::vector<Disco
         const Discount& discount = discounts[i];
 
         std::string targetsStr;
-        if (discount.targets.size() <= 2) 
+        auto targets = discount.getTargetNames();
+        if (targets.size() <= 2) 
         {
-            for (size_t j = 0; j < discount.targets.size(); j++) 
+            for (size_t j = 0; j < targets.size(); j++) 
             {
-                targetsStr += discount.targets[j];
-                if (j < discount.targets.size() - 1) targetsStr += ", ";
+                targetsStr += targets[j];
+                if (j < targets.size() - 1) targetsStr += ", ";
             }
         }
         else 
         {
-            targetsStr = discount.targets[0] + ", " + discount.targets[1] + "... (+" +
-                std::to_string(discount.targets.size() - 2) + ")";
+            targetsStr = targets[0] + ", " + targets[1] + "... (+" +
+                std::to_string(targets.size() - 2) + ")";
         }
 
         std::string status = discount.isValid() ? "" : "";
@@ -632,8 +635,8 @@ void TableFormatter::displayDiscountsTableWithPagination(const std::vector<Disco
             << " | " << std::setw(columnWidths[1]) << std::left << truncateString(discount.type, columnWidths[1])
             << " | " << std::setw(columnWidths[2]) << std::left << truncateString(targetsStr, columnWidths[2])
             << " | " << std::setw(columnWidths[3]) << std::right << std::fixed << std::setprecision(1) << discount.percentage
-            << " | " << std::setw(columnWidths[4]) << std::left << truncateString(discount.startDate, columnWidths[4])
-            << " | " << std::setw(columnWidths[5]) << std::left << truncateString(discount.endDate, columnWidths[5])
+            << " | " << std::setw(columnWidths[4]) << std::left << truncateString(discount.startDate.toString(), columnWidths[4])
+            << " | " << std::setw(columnWidths[5]) << std::left << truncateString(discount.endDate.toString(), columnWidths[5])
             << " | " << std::setw(columnWidths[6]) << std::left << status
             << " |" << std::endl;
 
@@ -960,7 +963,7 @@ void TableFormatter::displaySalesTableWithPagination(const std::vector<Sale>& sa
 
         std::cout << "| " << std::setw(columnWidths[0]) << std::right << sale.getSaleId()
             << " | " << std::setw(columnWidths[1]) << std::right << sale.getCustomerId()
-            << " | " << std::setw(columnWidths[2]) << std::left << truncateString(sale.getSaleDateTime(), columnWidths[2])
+            << " | " << std::setw(columnWidths[2]) << std::left << truncateString(sale.getSaleDateTime().toString(), columnWidths[2])
             << " | " << std::setw(columnWidths[3]) << std::right << totalItems
             << " | " << std::setw(columnWidths[4]) << std::right << std::fixed << std::setprecision(2) << sale.getTotalAmount()
             << " | " << std::setw(columnWidths[5]) << std::right << std::fixed << std::setprecision(2) << sale.getDiscountAmount()
@@ -1011,7 +1014,7 @@ void TableFormatter::displaySalesTableDetailed(const std::vector<Sale>& sales, S
 
         Config::setColor(Config::COLOR_HEADER);
         std::cout << "| " << std::setw(columnWidths[0]) << std::left << " #" + std::to_string(sale.getSaleId())
-            << " | " << std::setw(columnWidths[1]) << std::left << ": " + sale.getSaleDateTime()
+            << " | " << std::setw(columnWidths[1]) << std::left << ": " + sale.getSaleDateTime().toString()
             << " | " << std::setw(columnWidths[2]) << std::left << ""
             << " | " << std::setw(columnWidths[3]) << std::left << ""
             << " | " << std::setw(columnWidths[4]) << std::left << ""
@@ -1032,7 +1035,7 @@ void TableFormatter::displaySalesTableDetailed(const std::vector<Sale>& sales, S
         printHorizontalLine(columnWidths);
 
         double saleTotal = 0;
-        auto items = sale.getItems();
+        const auto& items = sale.getItems();
         for (const auto& item : items) 
         {
             auto product = store.getProductById(item.first);
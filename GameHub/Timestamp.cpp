@@ -0,0 +1,69 @@
+#include "Timestamp.h"
+#include "Config.h"
+#include <algorithm>
+
+Timestamp::Timestamp() : seconds(0) {}
+
+Timestamp::Timestamp(int64_t secondsSinceEpoch) : seconds(secondsSinceEpoch) {}
+
+Timestamp Timestamp::now() 
+{
+    return Timestamp(static_cast<int64_t>(std::time(nullptr)));
+}
+
+Timestamp Timestamp::parse(const std::string& dateTime) 
+{
+    std::time_t time = Config::parseDateTime(dateTime);
+    if (time == -1) 
+    {
+        return Timestamp();
+    }
+    return Timestamp(static_cast<int64_t>(time));
+}
+
+int64_t Timestamp::getSeconds() const { return seconds; }
+
+bool Timestamp::isSet() const { return seconds != 0; }
+
+std::string Timestamp::toString() const 
+{
+    if (!isSet()) 
+    {
+        return "";
+    }
+
+    std::time_t time = static_cast<std::time_t>(seconds);
+    std::tm tm;
+    localtime_s(&tm, &time);
+
+    char buffer[80];
+    std::strftime(buffer, sizeof(buffer), Config::DATE_FORMAT.c_str(), &tm);
+    return std::string(buffer);
+}
+
+void Timestamp::serialize(BinaryWriter& out) const 
+{
+    size_t marker = BINARY_MARKER;
+    out.write(marker);
+    out.write(seconds);
+}
+
+void Timestamp::deserialize(BinaryReader& in) 
+{
+    size_t size = in.read<size_t>();
+    if (size == BINARY_MARKER) 
+    {
+        in.read(seconds);
+        return;
+    }
+
+    //  :    ,     
+    if (size > MAX_LEGACY_LENGTH) 
+    {
+        throw FileIOException("Corrupted timestamp field");
+    }
+
+    std::string legacy(in.position(), (std::min)(size, in.remaining()));
+    in.skip(size);
+    seconds = legacy.empty() ? 0 : parse(legacy).getSeconds();
+}
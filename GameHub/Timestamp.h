@@ -0,0 +1,39 @@
+#pragma once
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <ctime>
+#include "BinaryCodec.h"
+
+//       .   ,
+//   ".. ::"      .
+class Timestamp 
+{
+private:
+    int64_t seconds;
+
+    // ,         
+    static const size_t BINARY_MARKER = static_cast<size_t>(-1);
+    static const size_t MAX_LEGACY_LENGTH = 64;
+
+public:
+    Timestamp();
+    explicit Timestamp(int64_t secondsSinceEpoch);
+
+    static Timestamp now();
+    static Timestamp parse(const std::string& dateTime);
+
+    int64_t getSeconds() const;
+    bool isSet() const;
+    std::string toString() const;
+
+    void serialize(BinaryWriter& out) const;
+    void deserialize(BinaryReader& in);
+
+    bool operator==(const Timestamp& other) const { return seconds == other.seconds; }
+    bool operator!=(const Timestamp& other) const { return seconds != other.seconds; }
+    bool operator<(const Timestamp& other) const { return seconds < other.seconds; }
+    bool operator<=(const Timestamp& other) const { return seconds <= other.seconds; }
+    bool operator>(const Timestamp& other) const { return seconds > other.seconds; }
+    bool operator>=(const Timestamp& other) const { return seconds >= other.seconds; }
+};
@@ -6,7 +6,7 @@ User::User(int id, const std::string& username, const std::string& passwordHash,
     const std::string& email, const std::string& phone, const std::string& role)
     : id(id), username(username), passwordHash(passwordHash),
     email(email), phone(phone), role(role), isApproved(role == "admin"),
-    registrationDate(Config::getCurrentDateTime()) {
+    registrationDate(Timestamp::now()) {
 }
 
 int User::getId() const { return id; }
@@ -16,8 +16,8 @@ std::string User::getEmail() const { return email; }
 std::string User::getPhone() const { return phone; }
 std::string User::getRole() const { return role; }
 bool User::getIsApproved() const { return isApproved; }
-std::string User::getRegistrationDate() const { return registrationDate; }
-std::string User::getUnlockDate() const { return unlockDate; }
+Timestamp User::getRegistrationDate() const { return registrationDate; }
+Timestamp User::getUnlockDate() const { return unlockDate; }
 
 void User::setUsername(const std::string& newUsername) { username = newUsername; }
 void User::setPasswordHash(const std::string& newHash) { passwordHash = newHash; }
@@ -25,83 +25,22 @@ void User::setEmail(const std::string& newEmail) { email = newEmail; }
 void User::setPhone(const std::string& newPhone) { phone = newPhone; }
 void User::setRole(const std::string& newRole) { role = newRole; }
 void User::setIsApproved(bool approved) { isApproved = approved; }
-void User::setUnlockDate(const std::string& date) { unlockDate = date; }
+void User::setUnlockDate(const Timestamp& date) { unlockDate = date; }
 
-void User::serialize(std::ostream& os) const 
+void User::serialize(BinaryWriter& out) const 
 {
-    os.write(reinterpret_cast<const char*>(&id), sizeof(id));
-
-    size_t size = username.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(username.c_str(), size);
-
-    size = passwordHash.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(passwordHash.c_str(), size);
-
-    size = email.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(email.c_str(), size);
-
-    size = phone.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(phone.c_str(), size);
-
-    size = role.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(role.c_str(), size);
-
-    os.write(reinterpret_cast<const char*>(&isApproved), sizeof(isApproved));
-
-    size = registrationDate.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(registrationDate.c_str(), size);
-
-    size = unlockDate.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(unlockDate.c_str(), size);
+    Schema::write(out, *this);
 }
 
-void User::deserialize(std::istream& is) 
+void User::deserialize(BinaryReader& in, uint16_t schemaRevision) 
 {
-    is.read(reinterpret_cast<char*>(&id), sizeof(id));
-
-    size_t size;
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    username.resize(size);
-    is.read(&username[0], size);
-
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    passwordHash.resize(size);
-    is.read(&passwordHash[0], size);
-
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    email.resize(size);
-    is.read(&email[0], size);
-
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    phone.resize(size);
-    is.read(&phone[0], size);
-
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    role.resize(size);
-    is.read(&role[0], size);
-
-    is.read(reinterpret_cast<char*>(&isApproved), sizeof(isApproved));
-
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    registrationDate.resize(size);
-    is.read(&registrationDate[0], size);
-
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    unlockDate.resize(size);
-    is.read(&unlockDate[0], size);
+    Schema::read(in, *this, schemaRevision);
 }
 
 bool User::isBlocked() const 
 {
-    if (unlockDate.empty()) return false;
-    return Config::getCurrentDateTime() < unlockDate;
+    if (!unlockDate.isSet()) return false;
+    return Timestamp::now() < unlockDate;
 }
 
 
@@ -122,12 +61,12 @@ void Admin::displayProfile() const
     std::cout << " : " << username << std::endl;
     std::cout << "Email: " << email << std::endl;
     std::cout << ": " << phone << std::endl;
-    std::cout << " : " << registrationDate << std::endl;
+    std::cout << " : " << registrationDate.toString() << std::endl;
 
-    if (!unlockDate.empty()) 
+    if (unlockDate.isSet()) 
     {
         Config::setColor(Config::COLOR_WARNING);
-        std::cout << "  : " << unlockDate << std::endl;
+        std::cout << "  : " << unlockDate.toString() << std::endl;
         Config::resetColor();
     }
 }
@@ -164,13 +103,13 @@ void Customer::displayProfile() const
     std::cout << ": " << phone << std::endl;
     std::cout << " : " << birthday << std::endl;
     std::cout << " : " << totalSpent << " ." << std::endl;
-    std::cout << " : " << registrationDate << std::endl;
+    std::cout << " : " << registrationDate.toString() << std::endl;
     std::cout << ": " << (isApproved ? "" : " ") << std::endl;
 
-    if (!unlockDate.empty()) 
+    if (unlockDate.isSet()) 
     {
         Config::setColor(Config::COLOR_WARNING);
-        std::cout << "  : " << unlockDate << std::endl;
+        std::cout << "  : " << unlockDate.toString() << std::endl;
         Config::resetColor();
     }
 }
@@ -185,27 +124,12 @@ void Customer::addPurchase(double amount)
     totalSpent += amount;
 }
 
-void Customer::serialize(std::ostream& os) const 
+void Customer::serialize(BinaryWriter& out) const 
 {
-    User::serialize(os);
-    os.write(reinterpret_cast<const char*>(&totalSpent), sizeof(totalSpent));
-
-    size_t size = birthday.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(birthday.c_str(), size);
-
-    os.write(reinterpret_cast<const char*>(&lastPurchasedProductId), sizeof(lastPurchasedProductId));
+    Schema::write(out, *this);
 }
 
-void Customer::deserialize(std::istream& is) 
+void Customer::deserialize(BinaryReader& in, uint16_t schemaRevision) 
 {
-    User::deserialize(is);
-    is.read(reinterpret_cast<char*>(&totalSpent), sizeof(totalSpent));
-
-    size_t size;
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    birthday.resize(size);
-    is.read(&birthday[0], size);
-
-    is.read(reinterpret_cast<char*>(&lastPurchasedProductId), sizeof(lastPurchasedProductId));
+    Schema::read(in, *this, schemaRevision);
 }
\ No newline at end of file
@@ -6,6 +6,9 @@
 #include "Config.h"
 #include "Exceptions.h"
 #include "Logger.h"
+#include "Timestamp.h"
+#include "BinaryCodec.h"
+#include "Schema.h"
 
 class User 
 {
@@ -17,8 +20,17 @@ protected:
     std::string phone;
     std::string role;
     bool isApproved;
-    std::string registrationDate;
-    std::string unlockDate;
+    Timestamp registrationDate;
+    Timestamp unlockDate;
+
+    friend struct Schema::Access;
+    static auto fields() 
+    {
+        return std::make_tuple(
+            Schema::field(&User::id), Schema::field(&User::username), Schema::field(&User::passwordHash),
+            Schema::field(&User::email), Schema::field(&User::phone), Schema::field(&User::role),
+            Schema::field(&User::isApproved), Schema::field(&User::registrationDate), Schema::field(&User::unlockDate));
+    }
 
 public:
     User();
@@ -33,8 +45,8 @@ public:
     std::string getPhone() const;
     std::string getRole() const;
     bool getIsApproved() const;
-    std::string getRegistrationDate() const;
-    std::string getUnlockDate() const;
+    Timestamp getRegistrationDate() const;
+    Timestamp getUnlockDate() const;
 
     void setUsername(const std::string& newUsername);
     void setPasswordHash(const std::string& newHash);
@@ -42,14 +54,14 @@ public:
     void setPhone(const std::string& newPhone);
     void setRole(const std::string& newRole);
     void setIsApproved(bool approved);
-    void setUnlockDate(const std::string& date);
+    void setUnlockDate(const Timestamp& date);
 
     //  
     virtual void displayProfile() const = 0;
     virtual std::string getUserType() const = 0;
 
-    virtual void serialize(std::ostream& os) const;
-    virtual void deserialize(std::istream& is);
+    virtual void serialize(BinaryWriter& out) const;
+    virtual void deserialize(BinaryReader& in, uint16_t schemaRevision);
 
     bool isBlocked() const;
 
@@ -73,6 +85,15 @@ private:
     std::string birthday;
     int lastPurchasedProductId;
 
+    //      
+    friend struct Schema::Access;
+    static auto fields() 
+    {
+        return std::tuple_cat(User::fields(), std::make_tuple(
+            Schema::field(&Customer::totalSpent), Schema::field(&Customer::birthday),
+            Schema::field(&Customer::lastPurchasedProductId)));
+    }
+
 public:
     Customer();
     Customer(int id, const std::string& username, const std::string& passwordHash,
@@ -90,6 +111,6 @@ public:
 
     void addPurchase(double amount);
 
-    void serialize(std::ostream& os) const override;
-    void deserialize(std::istream& is) override;
+    void serialize(BinaryWriter& out) const override;
+    void deserialize(BinaryReader& in, uint16_t schemaRevision) override;
 };
@@ -7,25 +7,9 @@ Wishlist::Wishlist(FileManager& fm) : fileManager(fm)
     loadWishlist();
 }
 
-void Wishlist::WishlistItem::serialize(std::ostream& os) const 
+Wishlist::Wishlist(FileManager& fm, std::vector<WishlistItem> items) : wishlistItems(std::move(items)), fileManager(fm) 
 {
-    os.write(reinterpret_cast<const char*>(&customerId), sizeof(customerId));
-    os.write(reinterpret_cast<const char*>(&productId), sizeof(productId));
-
-    size_t size = addedDate.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    os.write(addedDate.c_str(), size);
-}
-
-void Wishlist::WishlistItem::deserialize(std::istream& is) 
-{
-    is.read(reinterpret_cast<char*>(&customerId), sizeof(customerId));
-    is.read(reinterpret_cast<char*>(&productId), sizeof(productId));
-
-    size_t size;
-    is.read(reinterpret_cast<char*>(&size), sizeof(size));
-    addedDate.resize(size);
-    is.read(&addedDate[0], size);
+    logger = Logger::getInstance();
 }
 
 bool Wishlist::addToWishlist(int customerId, int productId) 
@@ -8,6 +8,7 @@
 #include "Logger.h"
 #include "Exceptions.h"
 #include "TableFormatter.h"
+#include "Schema.h"
 
 class FileManager;
 
@@ -26,8 +27,12 @@ public:
             : customerId(custId), productId(prodId), addedDate(date) {
         }
 
-        void serialize(std::ostream& os) const;
-        void deserialize(std::istream& is);
+        static auto fields() 
+        {
+            return std::make_tuple(
+                Schema::field(&WishlistItem::customerId), Schema::field(&WishlistItem::productId),
+                Schema::field(&WishlistItem::addedDate));
+        }
     };
 
 private:
@@ -38,6 +43,7 @@ private:
 
 public:
     explicit Wishlist(FileManager& fm);
+    Wishlist(FileManager& fm, std::vector<WishlistItem> items);
 
     bool addToWishlist(int customerId, int productId);
     bool removeFromWishlist(int customerId, int productId);
@@ -52,3 +58,9 @@ private:
     void loadWishlist();
     void saveWishlist();
 };
+
+template<>
+struct RecordKey<Wishlist::WishlistItem> 
+{
+    static std::string of(const Wishlist::WishlistItem& item, size_t position);
+};
\ No newline at end of file